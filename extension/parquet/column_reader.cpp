@@ -240,6 +240,77 @@ void ColumnReader::InitializeRead(idx_t row_group_idx_p, const vector<ColumnChun
 	group_rows_available = chunk->meta_data.num_values;
 }
 
+static bool IsDictionaryEncoding(Encoding::type encoding) {
+	return encoding == Encoding::PLAIN_DICTIONARY || encoding == Encoding::RLE_DICTIONARY;
+}
+
+bool ColumnReader::IsDictionaryEncoded() const {
+	auto &meta_data = chunk->meta_data;
+	if (meta_data.__isset.encoding_stats) {
+		for (auto &encoding_stats : meta_data.encoding_stats) {
+			if (encoding_stats.page_type != PageType::DATA_PAGE && encoding_stats.page_type != PageType::DATA_PAGE_V2) {
+				continue;
+			}
+			if (encoding_stats.count > 0 && !IsDictionaryEncoding(encoding_stats.encoding)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	// without encoding stats we only know which encodings are used somewhere in the column chunk
+	// if any of these is not a dictionary (or level) encoding, some data pages might not be dictionary-encoded
+	bool has_dictionary_encoding = false;
+	for (auto &encoding : meta_data.encodings) {
+		if (IsDictionaryEncoding(encoding)) {
+			has_dictionary_encoding = true;
+		} else if (encoding != Encoding::RLE && encoding != Encoding::BIT_PACKED) {
+			return false;
+		}
+	}
+	return has_dictionary_encoding;
+}
+
+bool ColumnReader::ReadDictionary(idx_t &dictionary_size) {
+	if (!chunk || HasRepeats() || schema.type == Type::BOOLEAN || !IsDictionaryEncoded()) {
+		return false;
+	}
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+	trans.SetLocation(chunk_read_offset);
+
+	PageHeader page_hdr;
+	reader.Read(page_hdr, *protocol);
+	if (page_hdr.type != PageType::DICTIONARY_PAGE) {
+		return false;
+	}
+	PreparePage(page_hdr);
+	if (page_hdr.dictionary_page_header.num_values < 0) {
+		throw std::runtime_error("Invalid dictionary page header (num_values < 0)");
+	}
+	dictionary_size = NumericCast<idx_t>(page_hdr.dictionary_page_header.num_values);
+	Dictionary(std::move(block), dictionary_size);
+	ResetPage();
+	// the data pages follow the dictionary page - we don't need to read the dictionary again when scanning
+	chunk_read_offset = trans.GetLocation();
+	return true;
+}
+
+void ColumnReader::ReadDictionaryEntries(idx_t offset, idx_t count, Vector &result) {
+	D_ASSERT(count <= STANDARD_VECTOR_SIZE);
+	offset_buffer.resize(reader.allocator, sizeof(uint32_t) * count);
+	auto offsets = reinterpret_cast<uint32_t *>(offset_buffer.ptr);
+	for (idx_t i = 0; i < count; i++) {
+		offsets[i] = NumericCast<uint32_t>(offset + i);
+	}
+	// the dictionary does not contain NULL values
+	uint8_t defines[STANDARD_VECTOR_SIZE];
+	memset(defines, NumericCast<uint8_t>(max_define), count);
+	parquet_filter_t filter;
+	filter.set();
+
+	DictReference(result);
+	Offsets(offsets, defines, count, filter, 0, result);
+}
+
 void ColumnReader::PrepareRead(parquet_filter_t &filter) {
 	dict_decoder.reset();
 	defined_decoder.reset();
@@ -54,6 +54,12 @@ public:
 
 	virtual void Skip(idx_t num_values);
 
+	//! Reads the dictionary page of the column chunk (after InitializeRead) if all of its data pages are
+	//! dictionary-encoded. Returns false (without reading anything) otherwise
+	bool ReadDictionary(idx_t &dictionary_size);
+	//! Reads "count" entries of the dictionary loaded by ReadDictionary, starting at "offset", into "result"
+	void ReadDictionaryEntries(idx_t offset, idx_t count, Vector &result);
+
 	ParquetReader &Reader();
 	const LogicalType &Type() const;
 	const SchemaElement &Schema() const;
@@ -160,6 +166,7 @@ protected:
 	virtual void ResetPage();
 
 private:
+	bool IsDictionaryEncoded() const;
 	void AllocateBlock(idx_t size);
 	void AllocateCompressed(idx_t size);
 	void PrepareRead(parquet_filter_t &filter);
@@ -26,8 +26,11 @@
 #include "duckdb/common/helper.hpp"
 #include "duckdb/common/hive_partitioning.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/object_cache.hpp"
@@ -703,20 +706,76 @@ idx_t ParquetReader::GetGroupOffset(ParquetReaderScanState &state) {
 	return min_offset;
 }
 
+static FilterPropagateResult CheckParquetStringFilter(const Statistics &pq_col_stats,
+                                                      const ConstantFilter &constant_filter) {
+	auto &min_value = pq_col_stats.min_value;
+	auto &max_value = pq_col_stats.max_value;
+	return StringStats::CheckZonemap(const_data_ptr_cast(min_value.c_str()), min_value.size(),
+	                                 const_data_ptr_cast(max_value.c_str()), max_value.size(),
+	                                 constant_filter.comparison_type, StringValue::Get(constant_filter.constant));
+}
+
 static FilterPropagateResult CheckParquetStringFilter(BaseStatistics &stats, const Statistics &pq_col_stats,
                                                       TableFilter &filter) {
 	if (filter.filter_type == TableFilterType::CONSTANT_COMPARISON) {
-		auto &constant_filter = filter.Cast<ConstantFilter>();
+		return CheckParquetStringFilter(pq_col_stats, filter.Cast<ConstantFilter>());
+	} else if (filter.filter_type == TableFilterType::IN_FILTER) {
+		auto &in_filter = filter.Cast<InFilter>();
 		auto &min_value = pq_col_stats.min_value;
 		auto &max_value = pq_col_stats.max_value;
-		return StringStats::CheckZonemap(const_data_ptr_cast(min_value.c_str()), min_value.size(),
-		                                 const_data_ptr_cast(max_value.c_str()), max_value.size(),
-		                                 constant_filter.comparison_type, StringValue::Get(constant_filter.constant));
+		for (auto &value : in_filter.values) {
+			auto prune_result = StringStats::CheckZonemap(
+			    const_data_ptr_cast(min_value.c_str()), min_value.size(), const_data_ptr_cast(max_value.c_str()),
+			    max_value.size(), ExpressionType::COMPARE_EQUAL, StringValue::Get(value));
+			if (prune_result != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				return prune_result;
+			}
+		}
+		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	} else if (filter.filter_type == TableFilterType::DYNAMIC_FILTER) {
+		auto constant_filter = filter.Cast<DynamicFilter>().filter_data->GetFilter();
+		if (!constant_filter) {
+			return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+		return CheckParquetStringFilter(pq_col_stats, *constant_filter);
 	} else {
 		return filter.CheckStatistics(stats);
 	}
 }
 
+static void ApplyFilter(Vector &v, const TableFilter &filter, parquet_filter_t &filter_mask, idx_t count);
+
+//! Checks if any of the values of a fully dictionary-encoded column chunk can pass the filter
+static FilterPropagateResult CheckDictionary(ColumnReader &column_reader, TableFilter &filter) {
+	idx_t dictionary_size;
+	if (!column_reader.ReadDictionary(dictionary_size)) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	// NULL values are not stored in the dictionary, we can only prune if the filter rejects them
+	Vector null_vector(column_reader.Type(), 1);
+	FlatVector::SetNull(null_vector, 0, true);
+	parquet_filter_t null_mask;
+	null_mask.set();
+	ApplyFilter(null_vector, filter, null_mask, 1);
+	if (null_mask.test(0)) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	Vector dictionary(column_reader.Type());
+	for (idx_t offset = 0; offset < dictionary_size; offset += STANDARD_VECTOR_SIZE) {
+		auto count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, dictionary_size - offset);
+		column_reader.ReadDictionaryEntries(offset, count, dictionary);
+		parquet_filter_t filter_mask;
+		filter_mask.set();
+		ApplyFilter(dictionary, filter, filter_mask, count);
+		for (idx_t i = 0; i < count; i++) {
+			if (filter_mask.test(i)) {
+				return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+			}
+		}
+	}
+	return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+}
+
 void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t col_idx) {
 	auto &group = GetGroup(state);
 	auto column_id = reader_data.column_ids[col_idx];
@@ -774,6 +833,16 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 
 	state.root_reader->InitializeRead(state.group_idx_list[state.current_group], group.columns,
 	                                  *state.thrift_file_proto);
+
+	if (reader_data.filters) {
+		// the statistics could not rule out the row group - for dictionary-encoded columns we can check the
+		// dictionary, which contains exactly the (distinct) values in the column chunk
+		auto filter_entry = reader_data.filters->filters.find(reader_data.column_mapping[col_idx]);
+		if (filter_entry != reader_data.filters->filters.end() &&
+		    CheckDictionary(*column_reader, *filter_entry->second) == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+			state.group_offset = group.num_rows;
+		}
+	}
 }
 
 idx_t ParquetReader::NumRows() {
@@ -852,6 +921,23 @@ void FilterIsNotNull(Vector &v, parquet_filter_t &filter_mask, idx_t count) {
 	}
 }
 
+template <class FILTER>
+static void FilterSelection(Vector &v, const FILTER &filter, parquet_filter_t &filter_mask, idx_t count) {
+	// convert the mask into a selection vector, so we only hash the rows that are still relevant
+	SelectionVector sel(STANDARD_VECTOR_SIZE);
+	idx_t approved_tuple_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (filter_mask.test(i)) {
+			sel.set_index(approved_tuple_count++, i);
+		}
+	}
+	filter.Filter(v, count, sel, approved_tuple_count);
+	filter_mask.reset();
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		filter_mask.set(sel.get_index(i));
+	}
+}
+
 template <class T, class OP>
 void TemplatedFilterOperation(Vector &v, T constant, parquet_filter_t &filter_mask, idx_t count) {
 	if (v.GetVectorType() == VectorType::CONSTANT_VECTOR) {
@@ -891,7 +977,7 @@ void TemplatedFilterOperation(Vector &v, const Value &constant, parquet_filter_t
 }
 
 template <class OP>
-static void FilterOperationSwitch(Vector &v, Value &constant, parquet_filter_t &filter_mask, idx_t count) {
+static void FilterOperationSwitch(Vector &v, const Value &constant, parquet_filter_t &filter_mask, idx_t count) {
 	if (filter_mask.none() || count == 0) {
 		return;
 	}
@@ -940,7 +1026,7 @@ static void FilterOperationSwitch(Vector &v, Value &constant, parquet_filter_t &
 	}
 }
 
-static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter_mask, idx_t count) {
+static void ApplyFilter(Vector &v, const TableFilter &filter, parquet_filter_t &filter_mask, idx_t count) {
 	switch (filter.filter_type) {
 	case TableFilterType::CONJUNCTION_AND: {
 		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
@@ -994,6 +1080,19 @@ static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter
 		auto &child = StructVector::GetEntries(v)[struct_filter.child_idx];
 		ApplyFilter(*child, *struct_filter.child_filter, filter_mask, count);
 	} break;
+	case TableFilterType::BLOOM_FILTER:
+		FilterSelection(v, filter.Cast<BloomTableFilter>(), filter_mask, count);
+		break;
+	case TableFilterType::IN_FILTER:
+		FilterSelection(v, filter.Cast<InFilter>(), filter_mask, count);
+		break;
+	case TableFilterType::DYNAMIC_FILTER: {
+		auto constant_filter = filter.Cast<DynamicFilter>().filter_data->GetFilter();
+		if (constant_filter) {
+			ApplyFilter(v, *constant_filter, filter_mask, count);
+		}
+		break;
+	}
 	default:
 		D_ASSERT(0);
 		break;
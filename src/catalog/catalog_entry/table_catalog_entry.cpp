@@ -21,7 +21,7 @@ namespace duckdb {
 
 TableCatalogEntry::TableCatalogEntry(Catalog &catalog, SchemaCatalogEntry &schema, CreateTableInfo &info)
     : StandardEntry(CatalogType::TABLE_ENTRY, schema, catalog, info.table), columns(std::move(info.columns)),
-      constraints(std::move(info.constraints)) {
+      constraints(std::move(info.constraints)), sort_keys(std::move(info.sort_keys)) {
 	this->temporary = info.temporary;
 	this->dependencies = info.dependencies;
 	this->comment = info.comment;
@@ -69,6 +69,7 @@ unique_ptr<CreateInfo> TableCatalogEntry::GetInfo() const {
 	result->dependencies = dependencies;
 	std::for_each(constraints.begin(), constraints.end(),
 	              [&result](const unique_ptr<Constraint> &c) { result->constraints.emplace_back(c->Copy()); });
+	result->sort_keys = sort_keys;
 	result->comment = comment;
 	result->tags = tags;
 	return std::move(result);
@@ -193,6 +194,10 @@ const vector<unique_ptr<Constraint>> &TableCatalogEntry::GetConstraints() const
 	return constraints;
 }
 
+const vector<string> &TableCatalogEntry::GetSortKeys() const {
+	return sort_keys;
+}
+
 // LCOV_EXCL_START
 DataTable &TableCatalogEntry::GetStorage() {
 	throw InternalException("Calling GetStorage on a TableCatalogEntry that is not a DuckTableEntry");
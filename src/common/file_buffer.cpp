@@ -23,6 +23,8 @@ void FileBuffer::Init() {
 	size = 0;
 	internal_buffer = nullptr;
 	internal_size = 0;
+	allocation = nullptr;
+	allocation_size = 0;
 }
 
 FileBuffer::FileBuffer(FileBuffer &source, FileBufferType type_p) : allocator(source.allocator), type(type_p) {
@@ -31,29 +33,64 @@ FileBuffer::FileBuffer(FileBuffer &source, FileBufferType type_p) : allocator(so
 	size = source.size;
 	internal_buffer = source.internal_buffer;
 	internal_size = source.internal_size;
+	allocation = source.allocation;
+	allocation_size = source.allocation_size;
 
 	source.Init();
 }
 
 FileBuffer::~FileBuffer() {
-	if (!internal_buffer) {
+	if (!allocation) {
 		return;
 	}
-	allocator.FreeData(internal_buffer, internal_size);
+	allocator.FreeData(allocation, allocation_size);
+}
+
+static bool IsAlignedPointer(data_ptr_t pointer, idx_t alignment) {
+	return reinterpret_cast<uintptr_t>(pointer) % alignment == 0;
 }
 
 void FileBuffer::ReallocBuffer(size_t new_size) {
-	data_ptr_t new_buffer;
-	if (internal_buffer) {
-		new_buffer = allocator.ReallocateData(internal_buffer, internal_size, new_size);
-	} else {
-		new_buffer = allocator.AllocateData(new_size);
+	// buffers that are read from or written to disk must start at a sector boundary to support DIRECT_IO
+	const idx_t alignment = type == FileBufferType::TINY_BUFFER ? 1 : Storage::SECTOR_SIZE;
+	if (internal_buffer && internal_buffer == allocation) {
+		// the buffer is not over-allocated - try to resize it in-place
+		auto new_allocation = allocator.ReallocateData(allocation, allocation_size, new_size);
+		if (!new_allocation) {
+			throw std::bad_alloc();
+		}
+		internal_buffer = allocation = new_allocation;
+		internal_size = allocation_size = new_size;
+		if (IsAlignedPointer(internal_buffer, alignment)) {
+			// Caller must update these.
+			buffer = nullptr;
+			size = 0;
+			return;
+		}
 	}
-	if (!new_buffer) {
+	// allocate a new buffer - large allocations are typically page-aligned already
+	idx_t new_allocation_size = new_size;
+	auto new_allocation = allocator.AllocateData(new_allocation_size);
+	if (new_allocation && !IsAlignedPointer(new_allocation, alignment)) {
+		// the allocator does not align the buffer - over-allocate so we can align it ourselves
+		allocator.FreeData(new_allocation, new_allocation_size);
+		new_allocation_size = new_size + alignment - 1;
+		new_allocation = allocator.AllocateData(new_allocation_size);
+	}
+	if (!new_allocation) {
 		throw std::bad_alloc();
 	}
+	auto misalignment = reinterpret_cast<uintptr_t>(new_allocation) % alignment;
+	auto new_buffer = misalignment == 0 ? new_allocation : new_allocation + (alignment - misalignment);
+	if (internal_buffer) {
+		// move over the contents of the previous buffer
+		memcpy(new_buffer, internal_buffer, MinValue<idx_t>(internal_size, new_size));
+		allocator.FreeData(allocation, allocation_size);
+	}
 	internal_buffer = new_buffer;
 	internal_size = new_size;
+	allocation = new_allocation;
+	allocation_size = new_allocation_size;
 	// Caller must update these.
 	buffer = nullptr;
 	size = 0;
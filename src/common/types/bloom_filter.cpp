@@ -0,0 +1,85 @@
+#include "duckdb/common/types/bloom_filter.hpp"
+
+#include "duckdb/common/serializer/deserializer.hpp"
+#include "duckdb/common/serializer/serializer.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+
+namespace duckdb {
+
+constexpr const uint32_t BloomFilter::SALT[];
+
+BloomFilter::BloomFilter(idx_t expected_count, idx_t bits_per_key) {
+	const auto bit_count = MaxValue<idx_t>(expected_count, 1) * bits_per_key;
+	block_count = MinValue<idx_t>((bit_count + BLOCK_SIZE * 8 - 1) / (BLOCK_SIZE * 8), MAX_BLOCK_COUNT);
+	blocks = make_unsafe_uniq_array<uint32_t>(block_count * WORDS_PER_BLOCK);
+}
+
+void BloomFilter::Insert(const hash_t *hashes, idx_t count, bool parallel) {
+	if (!parallel) {
+		for (idx_t i = 0; i < count; i++) {
+			Insert(hashes[i]);
+		}
+		return;
+	}
+	// concurrent inserts can set bits in the same words, so these need to be atomic
+	for (idx_t i = 0; i < count; i++) {
+		const auto block = reinterpret_cast<atomic<uint32_t> *>(GetBlock(hashes[i]));
+		const auto key = static_cast<uint32_t>(hashes[i]);
+		for (idx_t word_idx = 0; word_idx < WORDS_PER_BLOCK; word_idx++) {
+			const auto mask = GetMask(key, word_idx);
+			if ((block[word_idx].load(std::memory_order_relaxed) & mask) == 0) {
+				block[word_idx].fetch_or(mask, std::memory_order_relaxed);
+			}
+		}
+	}
+}
+
+idx_t BloomFilter::Filter(Vector &input, idx_t count, SelectionVector &sel, idx_t &approved_tuple_count) const {
+	if (approved_tuple_count == 0) {
+		return 0;
+	}
+	// this flattens any vector that is not a constant or dictionary vector for all "count" rows
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+
+	Vector hashes(LogicalType::HASH);
+	VectorOperations::Hash(input, hashes, sel, approved_tuple_count);
+	if (hashes.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+		if (!vdata.validity.RowIsValid(0) || !Lookup(*ConstantVector::GetData<hash_t>(hashes))) {
+			approved_tuple_count = 0;
+		}
+		return approved_tuple_count;
+	}
+
+	// the hashes are written at the positions in "sel"
+	const auto hash_data = FlatVector::GetData<hash_t>(hashes);
+	SelectionVector result_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		const auto idx = sel.get_index(i);
+		if (vdata.validity.RowIsValid(vdata.sel->get_index(idx)) && Lookup(hash_data[idx])) {
+			result_sel.set_index(result_count++, idx);
+		}
+	}
+	sel.Initialize(result_sel);
+	approved_tuple_count = result_count;
+	return result_count;
+}
+
+void BloomFilter::Serialize(Serializer &serializer) const {
+	serializer.WriteProperty(100, "block_count", block_count);
+	serializer.WriteProperty(101, "blocks", const_data_ptr_cast(blocks.get()), SizeInBytes());
+}
+
+unique_ptr<BloomFilter> BloomFilter::Deserialize(Deserializer &deserializer) {
+	auto result = unique_ptr<BloomFilter>(new BloomFilter());
+	result->block_count = deserializer.ReadProperty<idx_t>(100, "block_count");
+	if (result->block_count == 0 || result->block_count > MAX_BLOCK_COUNT) {
+		throw SerializationException("Invalid bloom filter block count %llu", result->block_count);
+	}
+	result->blocks = make_unsafe_uniq_array_uninitialized<uint32_t>(result->block_count * WORDS_PER_BLOCK);
+	deserializer.ReadProperty(101, "blocks", data_ptr_cast(result->blocks.get()), result->SizeInBytes());
+	return result;
+}
+
+} // namespace duckdb
@@ -41,7 +41,8 @@ GroupedAggregateHashTable::GroupedAggregateHashTable(ClientContext &context, All
                                                      vector<AggregateObject> aggregate_objects_p,
                                                      idx_t initial_capacity, idx_t radix_bits)
     : BaseAggregateHashTable(context, allocator, aggregate_objects_p, std::move(payload_types_p)),
-      radix_bits(radix_bits), count(0), capacity(0), aggregate_allocator(make_shared_ptr<ArenaAllocator>(allocator)) {
+      radix_bits(radix_bits), count(0), skip_lookups(false), capacity(0),
+      aggregate_allocator(make_shared_ptr<ArenaAllocator>(allocator)) {
 
 	// Append hash column to the end and initialise the row layout
 	group_types_p.emplace_back(LogicalType::HASH);
@@ -150,7 +151,8 @@ void GroupedAggregateHashTable::Verify() {
 		D_ASSERT(entry.GetSalt() == ht_entry_t::ExtractSalt(hash));
 		total_count++;
 	}
-	D_ASSERT(total_count == Count());
+	// if we skip lookups, the groups are not inserted into the pointer table
+	D_ASSERT(total_count == (skip_lookups ? 0 : Count()));
 #endif
 }
 
@@ -162,6 +164,12 @@ void GroupedAggregateHashTable::ResetCount() {
 	count = 0;
 }
 
+void GroupedAggregateHashTable::SkipLookups() {
+	// the pointer table is not used anymore, clear it so it stays consistent with the groups we append from now on
+	ClearPointerTable();
+	skip_lookups = true;
+}
+
 void GroupedAggregateHashTable::SetRadixBits(idx_t radix_bits_p) {
 	radix_bits = radix_bits_p;
 }
@@ -314,11 +322,11 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	D_ASSERT(state.hash_salts.GetType() == LogicalType::HASH);
 
 	// Need to fit the entire vector, and resize at threshold
-	if (Count() + groups.size() > capacity || Count() + groups.size() > ResizeThreshold()) {
+	if (!skip_lookups && (Count() + groups.size() > capacity || Count() + groups.size() > ResizeThreshold())) {
 		Verify();
 		Resize(capacity * 2);
 	}
-	D_ASSERT(capacity - Count() >= groups.size()); // we need to be able to fit at least one vector of data
+	D_ASSERT(skip_lookups || capacity - Count() >= groups.size()); // we need to be able to fit at least one vector
 
 	group_hashes_v.Flatten(groups.size());
 	auto hashes = FlatVector::GetData<hash_t>(group_hashes_v);
@@ -359,6 +367,22 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	}
 	TupleDataCollection::GetVectorData(chunk_state, state.group_data.get());
 
+	if (skip_lookups) {
+		// Append every row as a new group, without looking it up in (or inserting it into) the pointer table
+		const auto &all_sel = *FlatVector::IncrementalSelectionVector();
+		partitioned_data->AppendUnified(state.append_state, state.group_chunk, all_sel, groups.size());
+		RowOperations::InitializeStates(layout, chunk_state.row_locations, all_sel, groups.size());
+
+		const auto row_locations = FlatVector::GetData<data_ptr_t>(chunk_state.row_locations);
+		const auto &row_sel = state.append_state.reverse_partition_sel;
+		for (idx_t index = 0; index < groups.size(); index++) {
+			addresses[index] = row_locations[row_sel.get_index(index)];
+			new_groups_out.set_index(index, index);
+		}
+		count += groups.size();
+		return groups.size();
+	}
+
 	idx_t new_group_count = 0;
 	idx_t remaining_entries = groups.size();
 	idx_t iteration_count;
@@ -0,0 +1,84 @@
+#include "duckdb/execution/index/bloom_index.hpp"
+
+#include "duckdb/common/enums/index_constraint_type.hpp"
+#include "duckdb/execution/index/index_type.hpp"
+#include "duckdb/storage/index_storage_info.hpp"
+
+namespace duckdb {
+
+BloomIndex::BloomIndex(const string &name, const vector<column_t> &column_ids, TableIOManager &table_io_manager,
+                       const vector<unique_ptr<Expression>> &unbound_expressions, AttachedDatabase &db)
+    : BoundIndex(name, BloomIndex::TYPE_NAME, IndexConstraintType::NONE, column_ids, table_io_manager,
+                 unbound_expressions, db) {
+}
+
+unique_ptr<BoundIndex> BloomIndex::Create(CreateIndexInput &input) {
+	if (input.constraint_type != IndexConstraintType::NONE) {
+		throw BinderException("BLOOM indexes cannot be used to enforce constraints");
+	}
+	return make_uniq<BloomIndex>(input.name, input.column_ids, input.table_io_manager, input.unbound_expressions,
+	                             input.db);
+}
+
+//===--------------------------------------------------------------------===//
+// Index Interface
+//===--------------------------------------------------------------------===//
+// the bloom filters are built from the row groups when these are checkpointed, the index itself does not need to track
+// any changes to the table
+ErrorData BloomIndex::Append(IndexLock &lock, DataChunk &entries, Vector &row_identifiers) {
+	return ErrorData();
+}
+
+void BloomIndex::VerifyAppend(DataChunk &chunk) {
+}
+
+void BloomIndex::VerifyAppend(DataChunk &chunk, ConflictManager &conflict_manager) {
+}
+
+void BloomIndex::CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_manager) {
+}
+
+void BloomIndex::CommitDrop(IndexLock &index_lock) {
+}
+
+void BloomIndex::Delete(IndexLock &lock, DataChunk &entries, Vector &row_identifiers) {
+}
+
+ErrorData BloomIndex::Insert(IndexLock &lock, DataChunk &input, Vector &row_identifiers) {
+	return ErrorData();
+}
+
+bool BloomIndex::MergeIndexes(IndexLock &state, BoundIndex &other_index) {
+	return true;
+}
+
+void BloomIndex::Vacuum(IndexLock &state) {
+}
+
+idx_t BloomIndex::GetInMemorySize(IndexLock &state) {
+	return 0;
+}
+
+string BloomIndex::VerifyAndToString(IndexLock &state, const bool only_verify) {
+	return only_verify ? string() : "BLOOM index " + name;
+}
+
+void BloomIndex::VerifyAllocations(IndexLock &state) {
+}
+
+IndexStorageInfo BloomIndex::GetStorageInfo(const case_insensitive_map_t<Value> &options, const bool to_wal) {
+	// there is no data to serialize, the index is restored from its options
+	IndexStorageInfo info(name);
+	info.options = options;
+	info.options[BloomIndex::TYPE_NAME] = Value::BOOLEAN(true);
+	return info;
+}
+
+string BloomIndex::GetConstraintViolationMessage(VerifyExistenceType verify_type, idx_t failed_index,
+                                                 DataChunk &input) {
+	throw InternalException("BLOOM indexes do not enforce any constraints");
+}
+
+constexpr const char *BloomIndex::TYPE_NAME;
+
+} // namespace duckdb
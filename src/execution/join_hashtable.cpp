@@ -2,6 +2,7 @@
 
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/radix_partitioning.hpp"
+#include "duckdb/common/types/bloom_filter.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/ht_entry.hpp"
 #include "duckdb/main/client_context.hpp"
@@ -20,7 +21,9 @@ JoinHashTable::SharedState::SharedState()
 
 JoinHashTable::ProbeState::ProbeState()
     : SharedState(), salt_v(LogicalType::UBIGINT), ht_offsets_v(LogicalType::UBIGINT),
-      ht_offsets_dense_v(LogicalType::UBIGINT), non_empty_sel(STANDARD_VECTOR_SIZE) {
+      ht_offsets_dense_v(LogicalType::UBIGINT), entries_dense_v(LogicalType::UBIGINT),
+      salts_dense_v(LogicalType::UBIGINT), salt_matches_v(LogicalType::BOOLEAN), non_empty_sel(STANDARD_VECTOR_SIZE),
+      salt_no_match_sel(STANDARD_VECTOR_SIZE) {
 }
 
 JoinHashTable::InsertState::InsertState(const JoinHashTable &ht)
@@ -215,45 +218,62 @@ static inline void GetRowPointersInternal(DataChunk &keys, TupleDataChunkState &
 		idx_t salt_match_count = 0;
 		idx_t key_no_match_count = 0;
 
-		// for each entry, linear probing until
-		// a) an empty entry is found -> return nullptr (do nothing, as vector is zeroed)
-		// b) an entry is found where the salt matches -> need to compare the keys
-		for (idx_t i = 0; i < remaining_count; i++) {
-			const auto row_index = remaining_sel->get_index(i);
-
-			idx_t &ht_offset = ht_offsets[row_index];
-			bool occupied;
-			ht_entry_t entry;
-
-			if (USE_SALTS) {
-				hash_t row_salt = salts[row_index];
-				// increment the ht_offset of the entry as long as next entry is occupied and salt does not match
-				while (true) {
-					entry = entries[ht_offset];
-					occupied = entry.IsOccupied();
-					bool salt_match = entry.GetSalt() == row_salt;
-
-					// condition for incrementing the ht_offset: occupied and row_salt does not match -> move to next
-					// entry
-					if (!occupied || salt_match) {
-						break;
-					}
+		if (USE_SALTS) {
+			// linear probing until
+			// a) an empty entry is found -> return nullptr (do nothing, as vector is zeroed)
+			// b) an entry is found where the salt matches -> need to compare the keys
+			// this is done for all remaining rows at once: first, we gather the entries (which is where the cache
+			// misses happen), then the salts are compared in a dense loop, which the compiler can vectorize
+			auto entries_dense = reinterpret_cast<ht_entry_t *>(FlatVector::GetData(state.entries_dense_v));
+			auto salts_dense = FlatVector::GetData<hash_t>(state.salts_dense_v);
+			auto salt_matches = FlatVector::GetData<bool>(state.salt_matches_v);
+
+			const SelectionVector *probe_sel = remaining_sel;
+			idx_t probe_count = remaining_count;
+			while (probe_count > 0) {
+				for (idx_t i = 0; i < probe_count; i++) {
+					const auto row_index = probe_sel->get_index(i);
+					entries_dense[i] = entries[ht_offsets[row_index]];
+					salts_dense[i] = salts[row_index];
+				}
+				for (idx_t i = 0; i < probe_count; i++) {
+					salt_matches[i] = entries_dense[i].GetSalt() == salts_dense[i];
+				}
 
-					IncrementAndWrap(ht_offset, ht->bitmask);
+				// occupied entries where the salt matches need a key comparison, occupied entries where the salt
+				// does not match move to the next entry, and empty entries need no further processing
+				idx_t next_probe_count = 0;
+				for (idx_t i = 0; i < probe_count; i++) {
+					const auto row_index = probe_sel->get_index(i);
+					const auto &entry = entries_dense[i];
+					const bool occupied = entry.IsOccupied();
+					const bool salt_match = occupied && salt_matches[i];
+					const bool salt_no_match = occupied && !salt_matches[i];
+
+					state.salt_match_sel.set_index(salt_match_count, row_index);
+					salt_match_count += salt_match;
+					state.salt_no_match_sel.set_index(next_probe_count, row_index);
+					next_probe_count += salt_no_match;
+
+					row_ptr_insert_to[row_index] = entry.GetPointerOrNull();
+					ht_offsets[row_index] = (ht_offsets[row_index] + salt_no_match) & ht->bitmask;
 				}
-			} else {
-				entry = entries[ht_offset];
-				occupied = entry.IsOccupied();
+				probe_sel = &state.salt_no_match_sel;
+				probe_count = next_probe_count;
 			}
+		} else {
+			for (idx_t i = 0; i < remaining_count; i++) {
+				const auto row_index = remaining_sel->get_index(i);
+				auto entry = entries[ht_offsets[row_index]];
 
-			// the entries we need to process in the next iteration are the ones that are occupied and the row_salt
-			// does not match, the ones that are empty need no further processing
-			state.salt_match_sel.set_index(salt_match_count, row_index);
-			salt_match_count += occupied;
+				// empty entries need no further processing, occupied ones need a key comparison
+				state.salt_match_sel.set_index(salt_match_count, row_index);
+				salt_match_count += entry.IsOccupied();
 
-			// entry might be empty, so the pointer in the entry is nullptr, but this does not matter as the row
-			// will not be compared anyway as with an empty entry we are already done
-			row_ptr_insert_to[row_index] = entry.GetPointerOrNull();
+				// entry might be empty, so the pointer in the entry is nullptr, but this does not matter as the row
+				// will not be compared anyway as with an empty entry we are already done
+				row_ptr_insert_to[row_index] = entry.GetPointerOrNull();
+			}
 		}
 
 		if (salt_match_count != 0) {
@@ -679,7 +699,7 @@ void JoinHashTable::InsertHashes(Vector &hashes_v, const idx_t count, TupleDataC
 	}
 }
 
-void JoinHashTable::InitializePointerTable() {
+void JoinHashTable::AllocatePointerTable() {
 	capacity = PointerTableCapacity(Count());
 	D_ASSERT(IsPowerOfTwo(capacity));
 
@@ -701,13 +721,20 @@ void JoinHashTable::InitializePointerTable() {
 	}
 	D_ASSERT(hash_map.GetSize() == capacity * sizeof(ht_entry_t));
 
-	// initialize HT with all-zero entries
-	std::fill_n(entries, capacity, ht_entry_t::GetEmptyEntry());
-
 	bitmask = capacity - 1;
 }
 
-void JoinHashTable::Finalize(idx_t chunk_idx_from, idx_t chunk_idx_to, bool parallel) {
+void JoinHashTable::InitializePointerTable(idx_t entry_idx_from, idx_t entry_idx_to) {
+	D_ASSERT(hash_map.get());
+	D_ASSERT(entry_idx_from <= entry_idx_to && entry_idx_to <= capacity);
+	// initialize HT with all-zero entries
+	// the memory is only physically allocated when it is written to for the first time, on the NUMA node of the writing
+	// thread - initializing the entries in parallel spreads them across the nodes of the threads that probe them
+	std::fill_n(entries + entry_idx_from, entry_idx_to - entry_idx_from, ht_entry_t::GetEmptyEntry());
+}
+
+void JoinHashTable::Finalize(idx_t chunk_idx_from, idx_t chunk_idx_to, bool parallel,
+                             optional_ptr<BloomFilter> bloom_filter) {
 	// Pointer table should be allocated
 	D_ASSERT(hash_map.get());
 
@@ -724,6 +751,10 @@ void JoinHashTable::Finalize(idx_t chunk_idx_from, idx_t chunk_idx_to, bool para
 		for (idx_t i = 0; i < count; i++) {
 			hash_data[i] = Load<hash_t>(row_locations[i] + pointer_offset);
 		}
+		if (bloom_filter) {
+			// the hashes are overwritten by InsertHashes, so we need to add them to the bloom filter first
+			bloom_filter->Insert(hash_data, count, parallel);
+		}
 		TupleDataChunkState &chunk_state = iterator.GetChunkState();
 
 		InsertHashes(hashes, count, chunk_state, insert_state, parallel);
@@ -0,0 +1,524 @@
+#include "duckdb/execution/operator/aggregate/physical_sort_aggregate.hpp"
+
+#include "duckdb/common/row_operations/row_operations.hpp"
+#include "duckdb/common/sort/sort.hpp"
+#include "duckdb/common/types/row/tuple_data_layout.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/parallel/base_pipeline_event.hpp"
+#include "duckdb/parallel/executor_task.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+namespace duckdb {
+
+PhysicalSortAggregate::PhysicalSortAggregate(ClientContext &context, vector<LogicalType> types_p,
+                                             vector<unique_ptr<Expression>> aggregates_p,
+                                             vector<unique_ptr<Expression>> groups_p, idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::SORT_GROUP_BY, std::move(types_p), estimated_cardinality),
+      groups(std::move(groups_p)), aggregates(std::move(aggregates_p)) {
+	D_ASSERT(!groups.empty());
+	for (auto &group : groups) {
+		D_ASSERT(group->type == ExpressionType::BOUND_REF);
+		orders.emplace_back(OrderType::ASCENDING, OrderByNullType::NULLS_LAST, group->Copy());
+	}
+
+	vector<BoundAggregateExpression *> bindings;
+	for (auto &expr : aggregates) {
+		D_ASSERT(expr->expression_class == ExpressionClass::BOUND_AGGREGATE);
+		auto &aggr = expr->Cast<BoundAggregateExpression>();
+		bindings.push_back(&aggr);
+	}
+	D_ASSERT(CanAggregate(aggregates));
+	aggregate_objects = AggregateObject::CreateAggregateObjects(bindings);
+}
+
+bool PhysicalSortAggregate::CanAggregate(const vector<unique_ptr<Expression>> &aggregates) {
+	for (auto &expr : aggregates) {
+		auto &aggr = expr->Cast<BoundAggregateExpression>();
+		if (aggr.IsDistinct() || aggr.filter || aggr.order_bys || !aggr.function.combine) {
+			// distinct, filtered and ordered aggregates are not supported in the sort aggregate
+			return false;
+		}
+	}
+	return true;
+}
+
+//===--------------------------------------------------------------------===//
+// Sink
+//===--------------------------------------------------------------------===//
+class SortAggregateGlobalSinkState : public GlobalSinkState {
+public:
+	SortAggregateGlobalSinkState(BufferManager &buffer_manager, const PhysicalSortAggregate &op,
+	                             RowLayout &payload_layout)
+	    : op(op), global_sort_state(buffer_manager, op.orders, payload_layout) {
+	}
+
+	const PhysicalSortAggregate &op;
+	//! Global sort state
+	GlobalSortState global_sort_state;
+	//! Memory usage per thread
+	idx_t memory_per_thread;
+};
+
+class SortAggregateLocalSinkState : public LocalSinkState {
+public:
+	SortAggregateLocalSinkState(ClientContext &context, const PhysicalSortAggregate &op) : key_executor(context) {
+		vector<LogicalType> key_types;
+		for (auto &order : op.orders) {
+			key_types.push_back(order.expression->return_type);
+			key_executor.AddExpression(*order.expression);
+		}
+		keys.Initialize(Allocator::Get(context), key_types);
+	}
+
+public:
+	//! The local sort state
+	LocalSortState local_sort_state;
+	//! Key expression executor, and chunk to hold the vectors
+	ExpressionExecutor key_executor;
+	DataChunk keys;
+};
+
+unique_ptr<GlobalSinkState> PhysicalSortAggregate::GetGlobalSinkState(ClientContext &context) const {
+	// the payload is the complete input: the groups and the inputs of the aggregates
+	RowLayout payload_layout;
+	payload_layout.Initialize(children[0]->types);
+	auto state =
+	    make_uniq<SortAggregateGlobalSinkState>(BufferManager::GetBufferManager(context), *this, payload_layout);
+	state->global_sort_state.external = ClientConfig::GetConfig(context).force_external;
+	state->memory_per_thread = GetMaxThreadMemory(context);
+	return std::move(state);
+}
+
+unique_ptr<LocalSinkState> PhysicalSortAggregate::GetLocalSinkState(ExecutionContext &context) const {
+	return make_uniq<SortAggregateLocalSinkState>(context.client, *this);
+}
+
+SinkResultType PhysicalSortAggregate::Sink(ExecutionContext &context, DataChunk &chunk,
+                                           OperatorSinkInput &input) const {
+	auto &gstate = input.global_state.Cast<SortAggregateGlobalSinkState>();
+	auto &lstate = input.local_state.Cast<SortAggregateLocalSinkState>();
+
+	auto &global_sort_state = gstate.global_sort_state;
+	auto &local_sort_state = lstate.local_sort_state;
+	if (!local_sort_state.initialized) {
+		local_sort_state.Initialize(global_sort_state, BufferManager::GetBufferManager(context.client));
+	}
+
+	auto &keys = lstate.keys;
+	keys.Reset();
+	lstate.key_executor.Execute(chunk, keys);
+	local_sort_state.SinkChunk(keys, chunk);
+
+	// sort the data once it reaches a certain size, so it can be spilled to disk
+	if (local_sort_state.SizeInBytes() >= gstate.memory_per_thread) {
+		local_sort_state.Sort(global_sort_state, true);
+	}
+	return SinkResultType::NEED_MORE_INPUT;
+}
+
+SinkCombineResultType PhysicalSortAggregate::Combine(ExecutionContext &context,
+                                                     OperatorSinkCombineInput &input) const {
+	auto &gstate = input.global_state.Cast<SortAggregateGlobalSinkState>();
+	auto &lstate = input.local_state.Cast<SortAggregateLocalSinkState>();
+	gstate.global_sort_state.AddLocalState(lstate.local_sort_state);
+	return SinkCombineResultType::FINISHED;
+}
+
+class SortAggregateMergeTask : public ExecutorTask {
+public:
+	SortAggregateMergeTask(shared_ptr<Event> event_p, ClientContext &context, SortAggregateGlobalSinkState &state,
+	                       const PhysicalOperator &op_p)
+	    : ExecutorTask(context, std::move(event_p), op_p), context(context), state(state) {
+	}
+
+	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override {
+		MergeSorter merge_sorter(state.global_sort_state, BufferManager::GetBufferManager(context));
+		merge_sorter.PerformInMergeRound();
+		event->FinishTask();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	ClientContext &context;
+	SortAggregateGlobalSinkState &state;
+};
+
+class SortAggregateMergeEvent : public BasePipelineEvent {
+public:
+	SortAggregateMergeEvent(SortAggregateGlobalSinkState &gstate_p, Pipeline &pipeline_p, const PhysicalOperator &op_p)
+	    : BasePipelineEvent(pipeline_p), gstate(gstate_p), op(op_p) {
+	}
+
+	SortAggregateGlobalSinkState &gstate;
+	const PhysicalOperator &op;
+
+public:
+	void Schedule() override {
+		auto &context = pipeline->GetClientContext();
+
+		auto &ts = TaskScheduler::GetScheduler(context);
+		auto num_threads = NumericCast<idx_t>(ts.NumberOfThreads());
+
+		vector<shared_ptr<Task>> merge_tasks;
+		for (idx_t tnum = 0; tnum < num_threads; tnum++) {
+			merge_tasks.push_back(make_uniq<SortAggregateMergeTask>(shared_from_this(), context, gstate, op));
+		}
+		SetTasks(std::move(merge_tasks));
+	}
+
+	void FinishEvent() override {
+		auto &global_sort_state = gstate.global_sort_state;
+
+		global_sort_state.CompleteMergeRound();
+		if (global_sort_state.sorted_blocks.size() > 1) {
+			// Multiple blocks remaining: Schedule the next round
+			PhysicalSortAggregate::ScheduleMergeTasks(*pipeline, *this, gstate);
+		}
+	}
+};
+
+SinkFinalizeType PhysicalSortAggregate::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+                                                 OperatorSinkFinalizeInput &input) const {
+	auto &state = input.global_state.Cast<SortAggregateGlobalSinkState>();
+	auto &global_sort_state = state.global_sort_state;
+
+	if (global_sort_state.sorted_blocks.empty()) {
+		// Empty input: there are no groups
+		return SinkFinalizeType::NO_OUTPUT_POSSIBLE;
+	}
+
+	global_sort_state.PrepareMergePhase();
+	if (global_sort_state.sorted_blocks.size() > 1) {
+		PhysicalSortAggregate::ScheduleMergeTasks(pipeline, event, state);
+	}
+	return SinkFinalizeType::READY;
+}
+
+void PhysicalSortAggregate::ScheduleMergeTasks(Pipeline &pipeline, Event &event,
+                                               SortAggregateGlobalSinkState &state) {
+	state.global_sort_state.InitializeMergeRound();
+	auto new_event = make_shared_ptr<SortAggregateMergeEvent>(state, pipeline, state.op);
+	event.InsertEvent(std::move(new_event));
+}
+
+//===--------------------------------------------------------------------===//
+// Source
+//===--------------------------------------------------------------------===//
+class SortAggregateGlobalSourceState : public GlobalSourceState {
+public:
+	//! The number of aggregate states we keep: every vector can close a group per row and keep one more group open
+	static constexpr const idx_t STATE_COUNT = STANDARD_VECTOR_SIZE + 1;
+	//! The arena is swapped out once it reaches this size, so it does not grow with the number of groups
+	static constexpr const idx_t ARENA_SWAP_THRESHOLD = 16ULL * 1024ULL * 1024ULL;
+
+public:
+	SortAggregateGlobalSourceState(ClientContext &context, const PhysicalSortAggregate &op);
+	~SortAggregateGlobalSourceState() override;
+
+	//! Aggregate the next sorted chunk, and append the groups that are completed by it to the result
+	void AggregateChunk(DataChunk &result);
+	//! Append the last group to the result
+	void FinalizeOpenGroup(DataChunk &result);
+
+	idx_t MaxThreads() override {
+		// the sorted data is aggregated in order by a single thread
+		return 1;
+	}
+
+public:
+	const PhysicalSortAggregate &op;
+	Allocator &allocator;
+	unique_ptr<PayloadScanner> scanner;
+	//! The sorted input chunk, and the inputs of the aggregates referencing it
+	DataChunk scan_chunk;
+	DataChunk aggregate_input_chunk;
+	//! The groups of the last row of the previous chunk
+	DataChunk last_group;
+	//! The position of the groups in the input
+	vector<idx_t> group_indexes;
+	bool finished = false;
+
+	//! The layout of the aggregate states
+	TupleDataLayout layout;
+	//! The aggregate states, which are used round-robin
+	AllocatedData state_data;
+	//! Allocator for the memory that is owned by the aggregate states
+	unique_ptr<ArenaAllocator> aggregate_allocator;
+	idx_t arena_swap_threshold = ARENA_SWAP_THRESHOLD;
+	//! Whether there is a group that is not completed yet, and its state
+	bool has_open_group = false;
+	idx_t open_state = 0;
+
+	Vector addresses;
+	Vector state_addresses;
+	Vector completed_addresses;
+	SelectionVector next_sel;
+	SelectionVector boundary_sel;
+	SelectionVector new_group_sel;
+	SelectionVector completed_sel;
+
+private:
+	data_ptr_t GetState(idx_t state_idx) {
+		return state_data.get() + state_idx * layout.GetRowWidth();
+	}
+	//! Move the state of the open group into a new arena, so the old one can be released
+	void SwapArena();
+};
+
+SortAggregateGlobalSourceState::SortAggregateGlobalSourceState(ClientContext &context,
+                                                               const PhysicalSortAggregate &op_p)
+    : op(op_p), allocator(Allocator::Get(context)), addresses(LogicalType::POINTER),
+      state_addresses(LogicalType::POINTER), completed_addresses(LogicalType::POINTER), next_sel(STANDARD_VECTOR_SIZE),
+      boundary_sel(STANDARD_VECTOR_SIZE), new_group_sel(STANDARD_VECTOR_SIZE), completed_sel(STANDARD_VECTOR_SIZE) {
+	auto &sink = op.sink_state->Cast<SortAggregateGlobalSinkState>();
+	auto &global_sort_state = sink.global_sort_state;
+	if (global_sort_state.sorted_blocks.empty()) {
+		finished = true;
+	} else {
+		D_ASSERT(global_sort_state.sorted_blocks.size() == 1);
+		scanner = make_uniq<PayloadScanner>(global_sort_state, true);
+	}
+
+	auto &input_types = op.children[0]->types;
+	scan_chunk.Initialize(allocator, input_types);
+
+	vector<LogicalType> group_types;
+	for (auto &group : op.groups) {
+		group_indexes.push_back(group->Cast<BoundReferenceExpression>().index);
+		group_types.push_back(group->return_type);
+	}
+	last_group.Initialize(allocator, group_types);
+
+	vector<LogicalType> payload_types;
+	for (auto &aggregate : op.aggregates) {
+		for (auto &child : aggregate->Cast<BoundAggregateExpression>().children) {
+			payload_types.push_back(child->return_type);
+		}
+	}
+	if (!payload_types.empty()) {
+		aggregate_input_chunk.InitializeEmpty(payload_types);
+	}
+
+	for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
+		next_sel.set_index(i, i + 1);
+	}
+
+	layout.Initialize(op.aggregate_objects);
+	state_data = allocator.Allocate(STATE_COUNT * layout.GetRowWidth());
+	aggregate_allocator = make_uniq<ArenaAllocator>(allocator);
+}
+
+SortAggregateGlobalSourceState::~SortAggregateGlobalSourceState() {
+	if (!has_open_group || !layout.HasDestructor()) {
+		return;
+	}
+	// the scan was interrupted before the last group was finalized
+	RowOperationsState row_state(*aggregate_allocator);
+	FlatVector::GetData<data_ptr_t>(addresses)[0] = GetState(open_state);
+	RowOperations::DestroyStates(row_state, layout, addresses, 1);
+}
+
+void SortAggregateGlobalSourceState::AggregateChunk(DataChunk &result) {
+	const auto count = scan_chunk.size();
+	D_ASSERT(count > 0);
+
+	// figure out at which rows a new group starts: first compare the first row with the last row of the previous chunk
+	bool new_first_group = !has_open_group;
+	for (idx_t group_idx = 0; group_idx < group_indexes.size() && !new_first_group; group_idx++) {
+		auto &group = scan_chunk.data[group_indexes[group_idx]];
+		new_first_group = VectorOperations::DistinctFrom(group, last_group.data[group_idx], nullptr, 1, &boundary_sel,
+		                                                 nullptr) > 0;
+	}
+	// then compare every other row with its predecessor
+	bool boundaries[STANDARD_VECTOR_SIZE];
+	memset(boundaries, 0, sizeof(bool) * count);
+	for (idx_t group_idx = 0; group_idx < group_indexes.size() && count > 1; group_idx++) {
+		auto &group = scan_chunk.data[group_indexes[group_idx]];
+		Vector next(group, next_sel, count - 1);
+		auto boundary_count = VectorOperations::DistinctFrom(next, group, nullptr, count - 1, &boundary_sel, nullptr);
+		for (idx_t i = 0; i < boundary_count; i++) {
+			boundaries[boundary_sel.get_index(i) + 1] = true;
+		}
+	}
+	boundaries[0] = new_first_group;
+
+	// assign a state to every row, and collect the groups that start or end in this chunk
+	auto row_states = FlatVector::GetData<data_ptr_t>(addresses);
+	auto completed_states = FlatVector::GetData<data_ptr_t>(completed_addresses);
+	idx_t new_group_count = 0;
+	idx_t completed_count = 0;
+	const auto completes_open_group = has_open_group && new_first_group;
+	if (completes_open_group) {
+		completed_states[completed_count++] = GetState(open_state);
+	}
+	idx_t state_idx = open_state;
+	for (idx_t i = 0; i < count; i++) {
+		if (boundaries[i]) {
+			if (i > 0 || has_open_group) {
+				state_idx = (state_idx + 1) % STATE_COUNT;
+			}
+			if (i > 0) {
+				completed_sel.set_index(completed_count, i - 1);
+				completed_states[completed_count++] = row_states[i - 1];
+			}
+			new_group_sel.set_index(new_group_count++, i);
+		}
+		row_states[i] = GetState(state_idx);
+	}
+	RowOperations::InitializeStates(layout, addresses, new_group_sel, new_group_count);
+
+	// update the states
+	RowOperationsState row_state(*aggregate_allocator);
+	idx_t payload_idx = 0;
+	for (auto &aggregate : op.aggregates) {
+		for (auto &child : aggregate->Cast<BoundAggregateExpression>().children) {
+			auto &bound_ref = child->Cast<BoundReferenceExpression>();
+			aggregate_input_chunk.data[payload_idx++].Reference(scan_chunk.data[bound_ref.index]);
+		}
+	}
+	aggregate_input_chunk.SetCardinality(count);
+	VectorOperations::Copy(addresses, state_addresses, count, 0, 0);
+	VectorOperations::AddInPlace(state_addresses, NumericCast<int64_t>(layout.GetAggrOffset()), count);
+	payload_idx = 0;
+	for (auto &aggr : layout.GetAggregates()) {
+		RowOperations::UpdateStates(row_state, aggr, state_addresses, aggregate_input_chunk, payload_idx, count);
+		payload_idx += aggr.child_count;
+		VectorOperations::AddInPlace(state_addresses, NumericCast<int64_t>(aggr.payload_size), count);
+	}
+
+	// finalize the groups that were completed in this chunk
+	if (completed_count > 0) {
+		idx_t target_offset = 0;
+		if (completes_open_group) {
+			for (idx_t group_idx = 0; group_idx < group_indexes.size(); group_idx++) {
+				VectorOperations::Copy(last_group.data[group_idx], result.data[group_idx], 1, 0, 0);
+			}
+			target_offset = 1;
+		}
+		for (idx_t group_idx = 0; group_idx < group_indexes.size(); group_idx++) {
+			VectorOperations::Copy(scan_chunk.data[group_indexes[group_idx]], result.data[group_idx], completed_sel,
+			                       completed_count, target_offset, target_offset);
+		}
+		result.SetCardinality(completed_count);
+		RowOperations::FinalizeStates(row_state, layout, completed_addresses, result, group_indexes.size());
+		if (layout.HasDestructor()) {
+			RowOperations::DestroyStates(row_state, layout, completed_addresses, completed_count);
+		}
+	}
+
+	// the group of the last row stays open
+	last_group.Reset();
+	for (idx_t group_idx = 0; group_idx < group_indexes.size(); group_idx++) {
+		VectorOperations::Copy(scan_chunk.data[group_indexes[group_idx]], last_group.data[group_idx], count,
+		                       count - 1, 0);
+	}
+	last_group.SetCardinality(1);
+	has_open_group = true;
+	open_state = state_idx;
+
+	if (aggregate_allocator->SizeInBytes() >= arena_swap_threshold) {
+		SwapArena();
+	}
+}
+
+void SortAggregateGlobalSourceState::SwapArena() {
+	D_ASSERT(has_open_group);
+	auto new_allocator = make_uniq<ArenaAllocator>(allocator);
+	auto new_state = (open_state + 1) % STATE_COUNT;
+
+	Vector source(LogicalType::POINTER);
+	Vector target(LogicalType::POINTER);
+	FlatVector::GetData<data_ptr_t>(source)[0] = GetState(open_state);
+	FlatVector::GetData<data_ptr_t>(target)[0] = GetState(new_state);
+	RowOperations::InitializeStates(layout, target, *FlatVector::IncrementalSelectionVector(), 1);
+
+	// combine the open group into a fresh state that allocates from the new arena
+	VectorOperations::AddInPlace(source, NumericCast<int64_t>(layout.GetAggrOffset()), 1);
+	VectorOperations::AddInPlace(target, NumericCast<int64_t>(layout.GetAggrOffset()), 1);
+	for (auto &aggr : layout.GetAggregates()) {
+		AggregateInputData aggr_input_data(aggr.GetFunctionData(), *new_allocator,
+		                                   AggregateCombineType::PRESERVE_INPUT);
+		aggr.function.combine(source, target, aggr_input_data, 1);
+		VectorOperations::AddInPlace(source, NumericCast<int64_t>(aggr.payload_size), 1);
+		VectorOperations::AddInPlace(target, NumericCast<int64_t>(aggr.payload_size), 1);
+	}
+	if (layout.HasDestructor()) {
+		RowOperationsState row_state(*aggregate_allocator);
+		FlatVector::GetData<data_ptr_t>(source)[0] = GetState(open_state);
+		RowOperations::DestroyStates(row_state, layout, source, 1);
+	}
+
+	aggregate_allocator = std::move(new_allocator);
+	open_state = new_state;
+	// a large open group is copied on every swap: make sure that this happens rarely
+	arena_swap_threshold = MaxValue<idx_t>(ARENA_SWAP_THRESHOLD, 2 * aggregate_allocator->SizeInBytes());
+}
+
+void SortAggregateGlobalSourceState::FinalizeOpenGroup(DataChunk &result) {
+	if (!has_open_group) {
+		return;
+	}
+	for (idx_t group_idx = 0; group_idx < group_indexes.size(); group_idx++) {
+		VectorOperations::Copy(last_group.data[group_idx], result.data[group_idx], 1, 0, 0);
+	}
+	result.SetCardinality(1);
+
+	RowOperationsState row_state(*aggregate_allocator);
+	FlatVector::GetData<data_ptr_t>(addresses)[0] = GetState(open_state);
+	RowOperations::FinalizeStates(row_state, layout, addresses, result, group_indexes.size());
+	has_open_group = false;
+	if (layout.HasDestructor()) {
+		RowOperations::DestroyStates(row_state, layout, addresses, 1);
+	}
+}
+
+unique_ptr<GlobalSourceState> PhysicalSortAggregate::GetGlobalSourceState(ClientContext &context) const {
+	return make_uniq<SortAggregateGlobalSourceState>(context, *this);
+}
+
+SourceResultType PhysicalSortAggregate::GetData(ExecutionContext &context, DataChunk &chunk,
+                                                OperatorSourceInput &input) const {
+	auto &gstate = input.global_state.Cast<SortAggregateGlobalSourceState>();
+	while (!gstate.finished) {
+		auto &scan_chunk = gstate.scan_chunk;
+		scan_chunk.Reset();
+		gstate.scanner->Scan(scan_chunk);
+		if (scan_chunk.size() == 0) {
+			gstate.FinalizeOpenGroup(chunk);
+			gstate.finished = true;
+		} else {
+			gstate.AggregateChunk(chunk);
+		}
+		if (chunk.size() > 0) {
+			return SourceResultType::HAVE_MORE_OUTPUT;
+		}
+	}
+	return SourceResultType::FINISHED;
+}
+
+InsertionOrderPreservingMap<string> PhysicalSortAggregate::ParamsToString() const {
+	InsertionOrderPreservingMap<string> result;
+	string groups_info;
+	for (idx_t i = 0; i < groups.size(); i++) {
+		if (i > 0) {
+			groups_info += "\n";
+		}
+		groups_info += groups[i]->GetName();
+	}
+	result["Groups"] = groups_info;
+
+	string aggregate_info;
+	for (idx_t i = 0; i < aggregates.size(); i++) {
+		if (i > 0) {
+			aggregate_info += "\n";
+		}
+		aggregate_info += aggregates[i]->GetName();
+	}
+	result["Aggregates"] = aggregate_info;
+	return result;
+}
+
+} // namespace duckdb
@@ -145,6 +145,8 @@ public:
 	unique_ptr<WindowPartitionGlobalSinkState> global_partition;
 	//! The execution functions
 	Executors executors;
+	//! For each function, the earlier aggregate over the same frame that it shares its bounds with (or itself)
+	vector<idx_t> shared_frames;
 };
 
 class WindowPartitionGlobalSinkState : public PartitionGlobalSinkState {
@@ -258,6 +260,20 @@ WindowGlobalSinkState::WindowGlobalSinkState(const PhysicalWindow &op, ClientCon
 		auto &wexpr = op.select_list[expr_idx]->Cast<BoundWindowExpression>();
 		auto wexec = WindowExecutorFactory(wexpr, context, mode);
 		executors.emplace_back(std::move(wexec));
+
+		//	Aggregates over the same frame only need to compute the frame bounds once
+		idx_t shared = expr_idx;
+		if (wexpr.type == ExpressionType::WINDOW_AGGREGATE) {
+			for (idx_t prev_idx = 0; prev_idx < expr_idx; ++prev_idx) {
+				auto &prev = executors[prev_idx]->wexpr;
+				if (shared_frames[prev_idx] == prev_idx && prev.type == ExpressionType::WINDOW_AGGREGATE &&
+				    prev.FramesAreEquivalent(wexpr)) {
+					shared = prev_idx;
+					break;
+				}
+			}
+		}
+		shared_frames.emplace_back(shared);
 	}
 
 	global_partition = make_uniq<WindowPartitionGlobalSinkState>(*this, wexpr);
@@ -623,6 +639,14 @@ WindowHashGroup::ExecutorGlobalStates &WindowHashGroup::Initialize(WindowGlobalS
 		gestates.emplace_back(wexec->GetGlobalState(count, partition_mask, order_mask));
 	}
 
+	//	Build the segment trees of aggregates over the same frame together
+	for (idx_t w = 0; w < executors.size(); ++w) {
+		const auto shared = gsink.shared_frames[w];
+		if (shared != w) {
+			WindowAggregateExecutor::ShareTree(*gestates[shared], *gestates[w]);
+		}
+	}
+
 	return gestates;
 }
 
@@ -811,6 +835,7 @@ void WindowLocalSourceState::GetData(DataChunk &result) {
 	scanner->Scan(input_chunk);
 
 	const auto &executors = gsource.gsink.executors;
+	const auto &shared_frames = gsource.gsink.shared_frames;
 	auto &gestates = window_hash_group->gestates;
 	auto &local_states = window_hash_group->thread_states.at(task->thread_idx);
 	output_chunk.Reset();
@@ -819,7 +844,13 @@ void WindowLocalSourceState::GetData(DataChunk &result) {
 		auto &gstate = *gestates[expr_idx];
 		auto &lstate = *local_states[expr_idx];
 		auto &result = output_chunk.data[expr_idx];
-		executor.Evaluate(position, input_chunk, result, lstate, gstate);
+		//	Functions that share a frame come after the one that computes the bounds
+		const auto shared = shared_frames[expr_idx];
+		if (shared != expr_idx) {
+			executor.Evaluate(position, input_chunk, result, lstate, gstate, local_states[shared].get());
+		} else {
+			executor.Evaluate(position, input_chunk, result, lstate, gstate);
+		}
 	}
 	output_chunk.SetCardinality(input_chunk);
 	output_chunk.Verify();
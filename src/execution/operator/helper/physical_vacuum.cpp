@@ -2,8 +2,10 @@
 
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/data_table_info.hpp"
 #include "duckdb/storage/statistics/distinct_statistics.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/storage/storage_manager.hpp"
 
 namespace duckdb {
 
@@ -93,6 +95,11 @@ SinkFinalizeType PhysicalVacuum::Finalize(Pipeline &pipeline, Event &event, Clie
 	for (idx_t col_idx = 0; col_idx < sink.column_distinct_stats.size(); col_idx++) {
 		tbl->GetStorage().SetDistinct(column_id_map.at(col_idx), std::move(sink.column_distinct_stats[col_idx]));
 	}
+	if (info->options.vacuum && !tbl->GetSortKeys().empty()) {
+		// re-sort all row groups of the table on the next checkpoint
+		tbl->GetStorage().GetDataTableInfo()->SetReorderRequested(true);
+		StorageManager::Get(tbl->ParentCatalog()).RequestCheckpoint();
+	}
 
 	return SinkFinalizeType::READY;
 }
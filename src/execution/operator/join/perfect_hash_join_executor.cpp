@@ -1,7 +1,9 @@
 #include "duckdb/execution/operator/join/perfect_hash_join_executor.hpp"
 
+#include "duckdb/common/operator/subtract.hpp"
 #include "duckdb/common/types/row/row_layout.hpp"
 #include "duckdb/execution/operator/join/physical_hash_join.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
 
 namespace duckdb {
 
@@ -11,26 +13,84 @@ PerfectHashJoinExecutor::PerfectHashJoinExecutor(const PhysicalHashJoin &join_p,
 }
 
 bool PerfectHashJoinExecutor::CanDoPerfectHashJoin() {
-	return perfect_join_statistics.is_build_small;
+	return perfect_join_statistics.is_build_small || perfect_join_statistics.is_build_candidate;
 }
 
 //===--------------------------------------------------------------------===//
 // Build
 //===--------------------------------------------------------------------===//
 bool PerfectHashJoinExecutor::BuildPerfectHashTable(LogicalType &key_type) {
-	// First, allocate memory for each build column
-	auto build_size = perfect_join_statistics.build_range + 1;
-	for (const auto &type : join.rhs_output_types) {
-		perfect_hash_table.emplace_back(type, build_size);
+	if (ht.Count() > MAX_BUILD_SIZE + 1) {
+		// more keys than fit in the largest possible range, so there must be duplicates
+		return false;
 	}
+	// Determine the build range from the keys, then allocate memory for each build column and fill it with build data
+	return FullScanHashTable(key_type);
+}
 
-	// and for duplicate_checking
-	bitmap_build_idx = make_unsafe_uniq_array_uninitialized<bool>(build_size);
-	memset(bitmap_build_idx.get(), 0, sizeof(bool) * build_size); // set false
-
-	// Now fill columns with build data
+template <typename T>
+bool PerfectHashJoinExecutor::TemplatedSetBuildRange(Vector &build_vector, idx_t count) {
+	UnifiedVectorFormat vector_data;
+	build_vector.ToUnifiedFormat(count, vector_data);
+	auto data = UnifiedVectorFormat::GetData<T>(vector_data);
+	bool has_value = false;
+	T min_value = NumericLimits<T>::Maximum();
+	T max_value = NumericLimits<T>::Minimum();
+	for (idx_t i = 0; i < count; i++) {
+		auto data_idx = vector_data.sel->get_index(i);
+		if (!vector_data.validity.RowIsValid(data_idx)) {
+			continue;
+		}
+		NumericStats::UpdateValue<T>(data[data_idx], min_value, max_value);
+		has_value = true;
+	}
+	if (!has_value) {
+		return false;
+	}
+	// compute the range in 64 bits, so small types cannot overflow
+	idx_t build_range;
+	if (std::is_signed<T>::value) {
+		int64_t signed_range;
+		if (!TrySubtractOperator::Operation(int64_t(max_value), int64_t(min_value), signed_range)) {
+			return false;
+		}
+		build_range = NumericCast<idx_t>(signed_range);
+	} else {
+		build_range = NumericCast<idx_t>(uint64_t(max_value) - uint64_t(min_value));
+	}
+	if (build_range > MAX_BUILD_SIZE) {
+		return false;
+	}
+	auto &type = build_vector.GetType();
+	perfect_join_statistics.build_min = Value::CreateValue<T>(min_value);
+	perfect_join_statistics.build_min.Reinterpret(type);
+	perfect_join_statistics.build_max = Value::CreateValue<T>(max_value);
+	perfect_join_statistics.build_max.Reinterpret(type);
+	perfect_join_statistics.build_range = build_range;
+	return true;
+}
 
-	return FullScanHashTable(key_type);
+bool PerfectHashJoinExecutor::SetBuildRange(Vector &build_vector, idx_t count) {
+	switch (build_vector.GetType().InternalType()) {
+	case PhysicalType::INT8:
+		return TemplatedSetBuildRange<int8_t>(build_vector, count);
+	case PhysicalType::INT16:
+		return TemplatedSetBuildRange<int16_t>(build_vector, count);
+	case PhysicalType::INT32:
+		return TemplatedSetBuildRange<int32_t>(build_vector, count);
+	case PhysicalType::INT64:
+		return TemplatedSetBuildRange<int64_t>(build_vector, count);
+	case PhysicalType::UINT8:
+		return TemplatedSetBuildRange<uint8_t>(build_vector, count);
+	case PhysicalType::UINT16:
+		return TemplatedSetBuildRange<uint16_t>(build_vector, count);
+	case PhysicalType::UINT32:
+		return TemplatedSetBuildRange<uint32_t>(build_vector, count);
+	case PhysicalType::UINT64:
+		return TemplatedSetBuildRange<uint64_t>(build_vector, count);
+	default:
+		return false;
+	}
 }
 
 bool PerfectHashJoinExecutor::FullScanHashTable(LogicalType &key_type) {
@@ -52,6 +112,25 @@ bool PerfectHashJoinExecutor::FullScanHashTable(LogicalType &key_type) {
 	Vector build_vector(key_type, key_count);
 	RowOperations::FullScanColumn(ht.layout, tuples_addresses, build_vector, key_count, 0);
 
+	// The statistics only bound the build range - now that the build side is materialized, we use its actual range
+	// This also allows a perfect hash join if the statistics were unknown, or too wide (e.g., because of a filter)
+	if (!SetBuildRange(build_vector, key_count)) {
+		return false;
+	}
+	const auto build_size = perfect_join_statistics.build_range + 1;
+	if (!perfect_join_statistics.is_build_small && build_size > key_count * MAX_BUILD_SPARSITY) {
+		return false;
+	}
+
+	// Allocate memory for each build column
+	for (const auto &type : join.rhs_output_types) {
+		perfect_hash_table.emplace_back(type, build_size);
+	}
+
+	// and for duplicate_checking
+	bitmap_build_idx = make_unsafe_uniq_array_uninitialized<bool>(build_size);
+	memset(bitmap_build_idx.get(), 0, sizeof(bool) * build_size); // set false
+
 	// Now fill the selection vector using the build keys and create a sequential vector
 	// TODO: add check for fast pass when probe is part of build domain
 	SelectionVector sel_build(key_count + 1);
@@ -68,7 +147,6 @@ bool PerfectHashJoinExecutor::FullScanHashTable(LogicalType &key_type) {
 	key_count = unique_keys; // do not consider keys out of the range
 
 	// Full scan the remaining build columns and fill the perfect hash table
-	const auto build_size = perfect_join_statistics.build_range + 1;
 	for (idx_t i = 0; i < join.rhs_output_types.size(); i++) {
 		auto &vector = perfect_hash_table[i];
 		const auto output_col_idx = ht.output_columns[i];
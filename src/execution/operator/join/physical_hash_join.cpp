@@ -1,6 +1,7 @@
 #include "duckdb/execution/operator/join/physical_hash_join.hpp"
 
 #include "duckdb/common/radix_partitioning.hpp"
+#include "duckdb/common/types/value_map.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/execution/operator/aggregate/ungrouped_aggregate_state.hpp"
 #include "duckdb/function/aggregate/distributive_functions.hpp"
@@ -14,7 +15,9 @@
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
@@ -102,7 +105,9 @@ unique_ptr<JoinFilterGlobalState> JoinFilterPushdownInfo::GetGlobalState(ClientC
                                                                          const PhysicalOperator &op) const {
 	// clear any previously set filters
 	// we can have previous filters for this operator in case of e.g. recursive CTEs
-	dynamic_filters->ClearFilters(op);
+	for (auto &filter : filters) {
+		filter.dynamic_filters->ClearFilters(op);
+	}
 	auto result = make_uniq<JoinFilterGlobalState>();
 	result->global_aggregate_state =
 	    make_uniq<GlobalUngroupedAggregateState>(BufferAllocator::Get(context), min_max_aggregates);
@@ -383,6 +388,68 @@ void PhysicalHashJoin::PrepareFinalize(ClientContext &context, GlobalSinkState &
 	gstate.temporary_memory_state->SetRemainingSize(gstate.total_size);
 }
 
+class HashJoinTableInitTask : public ExecutorTask {
+public:
+	HashJoinTableInitTask(shared_ptr<Event> event_p, ClientContext &context, HashJoinGlobalSinkState &sink_p,
+	                      idx_t entry_idx_from_p, idx_t entry_idx_to_p, const PhysicalOperator &op_p)
+	    : ExecutorTask(context, std::move(event_p), op_p), sink(sink_p), entry_idx_from(entry_idx_from_p),
+	      entry_idx_to(entry_idx_to_p) {
+	}
+
+	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override {
+		sink.hash_table->InitializePointerTable(entry_idx_from, entry_idx_to);
+		event->FinishTask();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	HashJoinGlobalSinkState &sink;
+	idx_t entry_idx_from;
+	idx_t entry_idx_to;
+};
+
+class HashJoinTableInitEvent : public BasePipelineEvent {
+public:
+	HashJoinTableInitEvent(Pipeline &pipeline_p, HashJoinGlobalSinkState &sink)
+	    : BasePipelineEvent(pipeline_p), sink(sink) {
+	}
+
+	HashJoinGlobalSinkState &sink;
+
+public:
+	void Schedule() override {
+		auto &context = pipeline->GetClientContext();
+
+		vector<shared_ptr<Task>> init_tasks;
+		auto &ht = *sink.hash_table;
+		const auto capacity = ht.capacity;
+		const auto num_threads = NumericCast<idx_t>(sink.num_threads);
+		if (num_threads == 1 || (capacity < PARALLEL_INIT_THRESHOLD && !context.config.verify_parallelism)) {
+			// Single-threaded initialization
+			init_tasks.push_back(
+			    make_uniq<HashJoinTableInitTask>(shared_from_this(), context, sink, 0U, capacity, sink.op));
+		} else {
+			// Parallel initialization
+			const auto entries_per_thread = MaxValue<idx_t>((capacity + num_threads - 1) / num_threads, 1);
+
+			idx_t entry_idx = 0;
+			for (idx_t thread_idx = 0; thread_idx < num_threads; thread_idx++) {
+				auto entry_idx_from = entry_idx;
+				auto entry_idx_to = MinValue<idx_t>(entry_idx_from + entries_per_thread, capacity);
+				init_tasks.push_back(make_uniq<HashJoinTableInitTask>(shared_from_this(), context, sink,
+				                                                      entry_idx_from, entry_idx_to, sink.op));
+				entry_idx = entry_idx_to;
+				if (entry_idx == capacity) {
+					break;
+				}
+			}
+		}
+		SetTasks(std::move(init_tasks));
+	}
+
+	static constexpr const idx_t PARALLEL_INIT_THRESHOLD = 1048576;
+};
+
 class HashJoinFinalizeTask : public ExecutorTask {
 public:
 	HashJoinFinalizeTask(shared_ptr<Event> event_p, ClientContext &context, HashJoinGlobalSinkState &sink_p,
@@ -392,7 +459,11 @@ public:
 	}
 
 	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override {
-		sink.hash_table->Finalize(chunk_idx_from, chunk_idx_to, parallel);
+		optional_ptr<BloomFilter> bloom_filter;
+		if (sink.global_filter_state) {
+			bloom_filter = sink.global_filter_state->bloom_filter.get();
+		}
+		sink.hash_table->Finalize(chunk_idx_from, chunk_idx_to, parallel, bloom_filter);
 		event->FinishTask();
 		return TaskExecutionResult::TASK_FINISHED;
 	}
@@ -446,6 +517,10 @@ public:
 	void FinishEvent() override {
 		sink.hash_table->GetDataCollection().VerifyEverythingPinned();
 		sink.hash_table->finalized = true;
+		if (sink.op.filter_pushdown) {
+			// all build-side keys have been inserted into the bloom filter (if any), we can now push it
+			sink.op.filter_pushdown->PushBloomFilter(*sink.global_filter_state, sink.op);
+		}
 	}
 
 	static constexpr const idx_t PARALLEL_CONSTRUCT_THRESHOLD = 1048576;
@@ -456,9 +531,13 @@ void HashJoinGlobalSinkState::ScheduleFinalize(Pipeline &pipeline, Event &event)
 		hash_table->finalized = true;
 		return;
 	}
-	hash_table->InitializePointerTable();
-	auto new_event = make_shared_ptr<HashJoinFinalizeEvent>(pipeline, *this);
-	event.InsertEvent(std::move(new_event));
+	hash_table->AllocatePointerTable();
+
+	auto new_init_event = make_shared_ptr<HashJoinTableInitEvent>(pipeline, *this);
+	event.InsertEvent(new_init_event);
+
+	auto new_finalize_event = make_shared_ptr<HashJoinFinalizeEvent>(pipeline, *this);
+	new_init_event->InsertEvent(std::move(new_finalize_event));
 }
 
 void HashJoinGlobalSinkState::InitializeProbeSpill() {
@@ -560,7 +639,51 @@ public:
 	}
 };
 
-void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const PhysicalOperator &op) const {
+static bool KeysAreDense(const Value &min_val, const Value &max_val, idx_t build_count) {
+	if (Value::NotDistinctFrom(min_val, max_val)) {
+		// there is only one key - the equality filter is exact
+		return true;
+	}
+	if (!min_val.type().IsIntegral()) {
+		return false;
+	}
+	// if the keys (almost) fill up the [min, max] range, the range filter is nearly as selective as a bloom filter
+	static constexpr const double DENSE_THRESHOLD = 4;
+	const auto range = max_val.DefaultCastAs(LogicalType::DOUBLE).GetValue<double>() -
+	                   min_val.DefaultCastAs(LogicalType::DOUBLE).GetValue<double>();
+	return range < static_cast<double>(build_count) * DENSE_THRESHOLD;
+}
+
+static vector<Value> GetDistinctBuildKeys(JoinHashTable &ht, idx_t join_condition) {
+	auto &data_collection = ht.GetDataCollection();
+
+	Vector tuples_addresses(LogicalType::POINTER, ht.Count());
+	// the join conditions are the first columns of the layout
+	Vector build_vector(ht.layout.GetTypes()[join_condition], ht.Count());
+	idx_t key_count = 0;
+	if (data_collection.ChunkCount() > 0) {
+		JoinHTScanState join_ht_state(data_collection, 0, data_collection.ChunkCount(),
+		                              TupleDataPinProperties::KEEP_EVERYTHING_PINNED);
+		key_count = ht.FillWithHTOffsets(join_ht_state, tuples_addresses);
+		data_collection.Gather(tuples_addresses, *FlatVector::IncrementalSelectionVector(), key_count, join_condition,
+		                       build_vector, *FlatVector::IncrementalSelectionVector(), nullptr);
+	}
+
+	value_set_t distinct_keys;
+	for (idx_t i = 0; i < key_count; i++) {
+		auto key = build_vector.GetValue(i);
+		if (!key.IsNull()) {
+			distinct_keys.insert(std::move(key));
+		}
+	}
+	vector<Value> result(distinct_keys.begin(), distinct_keys.end());
+	std::sort(result.begin(), result.end());
+	return result;
+}
+
+void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const PhysicalOperator &op,
+                                         JoinHashTable &ht) const {
+	const auto build_count = ht.Count();
 	// finalize the min/max aggregates
 	vector<LogicalType> min_max_types;
 	for (auto &aggr_expr : min_max_aggregates) {
@@ -586,21 +709,52 @@ void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const Ph
 			// table e.g. because they are part of a RIGHT join
 			continue;
 		}
+		if (!KeysAreDense(min_val, max_val, build_count)) {
+			// the keys are sparse within [min, max], so we can prune more than with a range filter
+			if (build_count <= IN_FILTER_THRESHOLD && !min_val.type().IsNested()) {
+				// the build side is small: push the exact set of keys
+				auto keys = GetDistinctBuildKeys(ht, filter.join_condition);
+				if (!keys.empty()) {
+					filter.dynamic_filters->PushFilter(op, filter_col_idx, make_uniq<InFilter>(std::move(keys)));
+				}
+			} else if (filter.join_condition == 0) {
+				// use a bloom filter over the first join key
+				gstate.bloom_filter_idx = filter_idx;
+			}
+		}
 		if (Value::NotDistinctFrom(min_val, max_val)) {
 			// min = max - generate an equality filter
 			auto constant_filter = make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, std::move(min_val));
-			dynamic_filters->PushFilter(op, filter_col_idx, std::move(constant_filter));
+			filter.dynamic_filters->PushFilter(op, filter_col_idx, std::move(constant_filter));
 		} else {
 			// min != max - generate a range filter
 			auto greater_equals =
 			    make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO, std::move(min_val));
-			dynamic_filters->PushFilter(op, filter_col_idx, std::move(greater_equals));
+			filter.dynamic_filters->PushFilter(op, filter_col_idx, std::move(greater_equals));
 			auto less_equals = make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO, std::move(max_val));
-			dynamic_filters->PushFilter(op, filter_col_idx, std::move(less_equals));
+			filter.dynamic_filters->PushFilter(op, filter_col_idx, std::move(less_equals));
 		}
 		// not null filter
-		dynamic_filters->PushFilter(op, filter_col_idx, make_uniq<IsNotNullFilter>());
+		filter.dynamic_filters->PushFilter(op, filter_col_idx, make_uniq<IsNotNullFilter>());
+	}
+}
+
+void JoinFilterPushdownInfo::InitializeBloomFilter(JoinFilterGlobalState &gstate, idx_t build_count) const {
+	if (!gstate.bloom_filter_idx.IsValid() || build_count > BloomFilter::MAX_KEY_COUNT) {
+		return;
+	}
+	gstate.bloom_filter = make_shared_ptr<BloomFilter>(build_count);
+}
+
+void JoinFilterPushdownInfo::PushBloomFilter(JoinFilterGlobalState &gstate, const PhysicalOperator &op) const {
+	if (!gstate.bloom_filter) {
+		return;
 	}
+	auto &filter = filters[gstate.bloom_filter_idx.GetIndex()];
+	auto &key_type = min_max_aggregates[gstate.bloom_filter_idx.GetIndex() * 2]->return_type;
+	filter.dynamic_filters->PushFilter(op, filter.probe_column_index.column_index,
+	                                   make_uniq<BloomTableFilter>(key_type, std::move(gstate.bloom_filter)));
+	gstate.bloom_filter.reset();
 }
 
 SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
@@ -646,7 +800,7 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	ht.Unpartition();
 
 	if (filter_pushdown && ht.Count() > 0) {
-		filter_pushdown->PushFilters(*sink.global_filter_state, *this);
+		filter_pushdown->PushFilters(*sink.global_filter_state, *this, ht);
 	}
 
 	// check for possible perfect hash table
@@ -659,6 +813,11 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	// In case of a large build side or duplicates, use regular hash join
 	if (!use_perfect_hash) {
 		sink.perfect_join_executor.reset();
+		if (filter_pushdown && ht.Count() > 0 && ht.equality_predicate_columns.size() == 1) {
+			// with a single equality condition, the hashes in the HT are the hashes of the join keys
+			// these are inserted into a bloom filter while the pointer table is constructed in the finalize tasks
+			filter_pushdown->InitializeBloomFilter(*sink.global_filter_state, ht.Count());
+		}
 		sink.ScheduleFinalize(pipeline, event);
 	}
 	sink.finalized = true;
@@ -969,7 +1128,8 @@ void HashJoinGlobalSourceState::PrepareBuild(HashJoinGlobalSinkState &sink) {
 
 	build_chunks_per_thread = MaxValue<idx_t>((build_chunk_count + sink.num_threads - 1) / sink.num_threads, 1);
 
-	ht.InitializePointerTable();
+	ht.AllocatePointerTable();
+	ht.InitializePointerTable(0, ht.capacity);
 
 	global_stage = HashJoinSourceStage::BUILD;
 }
@@ -28,6 +28,14 @@ bool PhysicalJoin::EmptyResultIfRHSIsEmpty() const {
 //===--------------------------------------------------------------------===//
 // Pipeline Construction
 //===--------------------------------------------------------------------===//
+static bool PushesFiltersAcrossPipelines(PhysicalOperator &op) {
+	if (op.type != PhysicalOperatorType::HASH_JOIN) {
+		return false;
+	}
+	auto &filter_pushdown = op.Cast<PhysicalHashJoin>().filter_pushdown;
+	return filter_pushdown && filter_pushdown->crosses_pipelines;
+}
+
 void PhysicalJoin::BuildJoinPipelines(Pipeline &current, MetaPipeline &meta_pipeline, PhysicalOperator &op,
                                       bool build_rhs) {
 	op.op_state.reset();
@@ -44,11 +52,15 @@ void PhysicalJoin::BuildJoinPipelines(Pipeline &current, MetaPipeline &meta_pipe
 
 	vector<shared_ptr<Pipeline>> dependencies;
 	optional_ptr<MetaPipeline> last_child_ptr;
+	bool pushes_filters = false;
 	if (build_rhs) {
 		// on the RHS (build side), we construct a child MetaPipeline with this operator as its sink
 		auto &child_meta_pipeline = meta_pipeline.CreateChildMetaPipeline(current, op, MetaPipelineType::JOIN_BUILD);
 		child_meta_pipeline.Build(*op.children[1]);
-		if (op.children[1]->CanSaturateThreads(current.GetClientContext())) {
+		// if the build side pushes filters into scans in LHS children (e.g., the build side of another join),
+		// these have to wait for the build side to be finished, otherwise the filters are not there yet
+		pushes_filters = PushesFiltersAcrossPipelines(op);
+		if (pushes_filters || op.children[1]->CanSaturateThreads(current.GetClientContext())) {
 			// if the build side can saturate all available threads,
 			// we don't just make the LHS pipeline depend on the RHS, but recursively all LHS children too.
 			// this prevents breadth-first plan evaluation
@@ -62,7 +74,7 @@ void PhysicalJoin::BuildJoinPipelines(Pipeline &current, MetaPipeline &meta_pipe
 
 	if (last_child_ptr) {
 		// the pointer was set, set up the dependencies
-		meta_pipeline.AddRecursiveDependencies(dependencies, *last_child_ptr);
+		meta_pipeline.AddRecursiveDependencies(dependencies, *last_child_ptr, !pushes_filters);
 	}
 
 	switch (op.type) {
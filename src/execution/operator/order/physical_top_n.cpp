@@ -6,6 +6,7 @@
 #include "duckdb/common/value_operations/value_operations.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/storage/data_table.hpp"
 
 namespace duckdb {
@@ -84,7 +85,8 @@ public:
 public:
 	void Sink(DataChunk &input);
 	void Combine(TopNHeap &other);
-	void Reduce();
+	//! Reduces the heap to the top-n rows (if it has grown large enough) - returns true if the heap was reduced
+	bool Reduce();
 	void Finalize();
 
 	void ExtractBoundaryValues(DataChunk &current_chunk, DataChunk &prev_chunk);
@@ -275,11 +277,11 @@ void TopNHeap::Finalize() {
 	sort_state.Finalize();
 }
 
-void TopNHeap::Reduce() {
+bool TopNHeap::Reduce() {
 	idx_t min_sort_threshold = MaxValue<idx_t>(STANDARD_VECTOR_SIZE * 5ULL, 2ULL * (limit + offset));
 	if (sort_state.count < min_sort_threshold) {
 		// only reduce when we pass two times the limit + offset, or 5 vectors (whichever comes first)
-		return;
+		return false;
 	}
 	sort_state.Finalize();
 	TopNSortState new_state(*this);
@@ -306,6 +308,7 @@ void TopNHeap::Reduce() {
 	}
 
 	sort_state.Move(new_state);
+	return true;
 }
 
 void TopNHeap::ExtractBoundaryValues(DataChunk &current_chunk, DataChunk &prev_chunk) {
@@ -407,8 +410,38 @@ public:
 
 	mutex lock;
 	TopNHeap heap;
+	//! The filter on the first ordering column that is pushed into the scan (if any)
+	shared_ptr<DynamicFilterData> dynamic_filter;
+
+public:
+	//! Tightens the pushed filter to the boundary value of the given heap
+	void UpdateDynamicFilter(const TopNHeap &source_heap);
 };
 
+void TopNGlobalState::UpdateDynamicFilter(const TopNHeap &source_heap) {
+	if (!dynamic_filter || !source_heap.has_boundary_values) {
+		return;
+	}
+	// every heap (local or global) holds limit + offset rows that are at least as good as its boundary value
+	// the final result can thus only contain rows with a first ordering value that is at least as good as it
+	// we compare inclusively, as rows with the same first ordering value can still win on the other columns
+	auto boundary_value = source_heap.boundary_values.GetValue(0, 0);
+	if (boundary_value.IsNull()) {
+		return;
+	}
+	lock_guard<mutex> l(dynamic_filter->lock);
+	if (dynamic_filter->filter) {
+		auto &current_value = dynamic_filter->filter->constant;
+		bool is_tighter = dynamic_filter->comparison_type == ExpressionType::COMPARE_LESSTHANOREQUALTO
+		                      ? boundary_value < current_value
+		                      : boundary_value > current_value;
+		if (!is_tighter) {
+			return;
+		}
+	}
+	dynamic_filter->SetValue(std::move(boundary_value));
+}
+
 class TopNLocalState : public LocalSinkState {
 public:
 	TopNLocalState(ExecutionContext &context, const vector<LogicalType> &payload_types,
@@ -424,7 +457,16 @@ unique_ptr<LocalSinkState> PhysicalTopN::GetLocalSinkState(ExecutionContext &con
 }
 
 unique_ptr<GlobalSinkState> PhysicalTopN::GetGlobalSinkState(ClientContext &context) const {
-	return make_uniq<TopNGlobalState>(context, types, orders, limit, offset);
+	auto result = make_uniq<TopNGlobalState>(context, types, orders, limit, offset);
+	if (dynamic_filters) {
+		// the operator can be executed multiple times (e.g. in a recursive CTE) - remove the filter of a previous run
+		dynamic_filters->ClearFilters(*this);
+		auto comparison_type = orders[0].type == OrderType::ASCENDING ? ExpressionType::COMPARE_LESSTHANOREQUALTO
+		                                                              : ExpressionType::COMPARE_GREATERTHANOREQUALTO;
+		result->dynamic_filter = make_shared_ptr<DynamicFilterData>(comparison_type);
+		dynamic_filters->PushFilter(*this, dynamic_filter_column, make_uniq<DynamicFilter>(result->dynamic_filter));
+	}
+	return std::move(result);
 }
 
 //===--------------------------------------------------------------------===//
@@ -432,9 +474,13 @@ unique_ptr<GlobalSinkState> PhysicalTopN::GetGlobalSinkState(ClientContext &cont
 //===--------------------------------------------------------------------===//
 SinkResultType PhysicalTopN::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const {
 	// append to the local sink state
+	auto &gstate = input.global_state.Cast<TopNGlobalState>();
 	auto &sink = input.local_state.Cast<TopNLocalState>();
 	sink.heap.Sink(chunk);
-	sink.heap.Reduce();
+	if (sink.heap.Reduce()) {
+		// the boundary value of the local heap has changed - push it into the scan
+		gstate.UpdateDynamicFilter(sink.heap);
+	}
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
@@ -448,6 +494,7 @@ SinkCombineResultType PhysicalTopN::Combine(ExecutionContext &context, OperatorS
 	// scan the local top N and append it to the global heap
 	lock_guard<mutex> glock(gstate.lock);
 	gstate.heap.Combine(lstate.heap);
+	gstate.UpdateDynamicFilter(gstate.heap);
 
 	return SinkCombineResultType::FINISHED;
 }
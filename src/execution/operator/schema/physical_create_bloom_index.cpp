@@ -0,0 +1,59 @@
+#include "duckdb/execution/operator/schema/physical_create_bloom_index.hpp"
+
+#include "duckdb/catalog/catalog_entry/duck_index_entry.hpp"
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/common/exception/transaction_exception.hpp"
+#include "duckdb/execution/index/bloom_index.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table_io_manager.hpp"
+
+namespace duckdb {
+
+PhysicalCreateBloomIndex::PhysicalCreateBloomIndex(LogicalOperator &op, TableCatalogEntry &table_p,
+                                                   const vector<column_t> &column_ids, unique_ptr<CreateIndexInfo> info,
+                                                   vector<unique_ptr<Expression>> unbound_expressions,
+                                                   idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::CREATE_INDEX, op.types, estimated_cardinality),
+      table(table_p.Cast<DuckTableEntry>()), info(std::move(info)),
+      unbound_expressions(std::move(unbound_expressions)) {
+
+	// Convert the virtual column ids to physical column ids.
+	for (auto &column_id : column_ids) {
+		storage_ids.push_back(table.GetColumns().LogicalToPhysical(LogicalIndex(column_id)).index);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Source
+//===--------------------------------------------------------------------===//
+SourceResultType PhysicalCreateBloomIndex::GetData(ExecutionContext &context, DataChunk &chunk,
+                                                   OperatorSourceInput &input) const {
+	auto &storage = table.GetStorage();
+	if (!storage.IsRoot()) {
+		throw TransactionException("Transaction conflict: cannot add an index to a table that has been altered!");
+	}
+
+	auto &schema = table.schema;
+	info->column_ids = storage_ids;
+
+	// Ensure that the index does not yet exist.
+	if (schema.GetEntry(schema.GetCatalogTransaction(context.client), CatalogType::INDEX_ENTRY, info->index_name)) {
+		if (info->on_conflict != OnCreateConflict::IGNORE_ON_CONFLICT) {
+			throw CatalogException("Index with name \"%s\" already exists!", info->index_name);
+		}
+		// IF NOT EXISTS on existing index. We are done.
+		return SourceResultType::FINISHED;
+	}
+
+	auto index = make_uniq<BloomIndex>(info->index_name, storage_ids, TableIOManager::Get(storage),
+	                                   unbound_expressions, storage.db);
+	auto index_entry = schema.CreateIndex(schema.GetCatalogTransaction(context.client), *info, table).get();
+	D_ASSERT(index_entry);
+	index_entry->Cast<DuckIndexEntry>().initial_index_size = 0;
+
+	// add index to storage
+	storage.AddIndex(std::move(index));
+	return SourceResultType::FINISHED;
+}
+
+} // namespace duckdb
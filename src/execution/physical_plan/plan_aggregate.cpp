@@ -2,6 +2,7 @@
 #include "duckdb/common/operator/subtract.hpp"
 #include "duckdb/execution/operator/aggregate/physical_hash_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_perfecthash_aggregate.hpp"
+#include "duckdb/execution/operator/aggregate/physical_sort_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_ungrouped_aggregate.hpp"
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
@@ -11,6 +12,7 @@
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 
 namespace duckdb {
 
@@ -149,6 +151,35 @@ static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate
 	return true;
 }
 
+static bool CanUseSortAggregate(ClientContext &context, LogicalAggregate &op) {
+	auto ratio = ClientConfig::GetConfig(context).sort_aggregate_memory_ratio;
+	if (ratio <= 0) {
+		return false;
+	}
+	if (op.grouping_sets.size() > 1 || !op.grouping_functions.empty()) {
+		return false;
+	}
+	if (!op.grouping_sets.empty() && op.grouping_sets[0].size() != op.groups.size()) {
+		return false;
+	}
+	if (!PhysicalSortAggregate::CanAggregate(op.expressions)) {
+		return false;
+	}
+	// estimate how large a hash table that holds all the groups would become
+	idx_t group_width = 0;
+	for (auto &group : op.groups) {
+		group_width += GetTypeIdSize(group->return_type.InternalType());
+	}
+	for (auto &expression : op.expressions) {
+		auto &aggregate = expression->Cast<BoundAggregateExpression>();
+		group_width += aggregate.function.state_size(aggregate.function);
+	}
+	auto estimated_size = static_cast<double>(op.estimated_cardinality) * static_cast<double>(group_width);
+	auto memory_limit = static_cast<double>(BufferManager::GetBufferManager(context).GetMaxMemory());
+	// only sort if the groups vastly exceed the memory: the hash aggregate can go out-of-core as well
+	return estimated_size > ratio * memory_limit;
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate &op) {
 	unique_ptr<PhysicalOperator> groupby;
 	D_ASSERT(op.children.size() == 1);
@@ -184,6 +215,10 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate
 			groupby = make_uniq_base<PhysicalOperator, PhysicalPerfectHashAggregate>(
 			    context, op.types, std::move(op.expressions), std::move(op.groups), std::move(op.group_stats),
 			    std::move(required_bits), op.estimated_cardinality);
+		} else if (CanUseSortAggregate(context, op)) {
+			// the groups are not expected to fit in memory by far: sort the input on the groups and aggregate the runs
+			groupby = make_uniq_base<PhysicalOperator, PhysicalSortAggregate>(
+			    context, op.types, std::move(op.expressions), std::move(op.groups), op.estimated_cardinality);
 		} else {
 			groupby = make_uniq_base<PhysicalOperator, PhysicalHashAggregate>(
 			    context, op.types, std::move(op.expressions), std::move(op.groups), std::move(op.grouping_sets),
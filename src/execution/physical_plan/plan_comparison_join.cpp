@@ -51,10 +51,6 @@ void CheckForPerfectJoinOpt(LogicalComparisonJoin &op, PerfectHashJoinStats &joi
 	if (op.conditions.size() != 1) {
 		return;
 	}
-	// with propagated statistics
-	if (op.join_stats.empty()) {
-		return;
-	}
 	for (auto &type : op.children[1]->types) {
 		switch (type.InternalType()) {
 		case PhysicalType::STRUCT:
@@ -72,14 +68,22 @@ void CheckForPerfectJoinOpt(LogicalComparisonJoin &op, PerfectHashJoinStats &joi
 		}
 	}
 	// with integral internal types
-	for (auto &&join_stat : op.join_stats) {
-		if (!TypeIsInteger(join_stat->GetType().InternalType()) ||
-		    join_stat->GetType().InternalType() == PhysicalType::INT128 ||
-		    join_stat->GetType().InternalType() == PhysicalType::UINT128) {
+	for (auto &&condition : op.conditions) {
+		const auto key_type = condition.left->return_type.InternalType();
+		if (!TypeIsInteger(key_type) || key_type == PhysicalType::INT128 || key_type == PhysicalType::UINT128 ||
+		    condition.right->return_type.InternalType() != key_type) {
 			// perfect join not possible for non-integral types or hugeint
 			return;
 		}
 	}
+	// the join could use a perfect hash table - if the statistics below cannot tell us whether the build is small,
+	// the hash join decides this after the build side has been materialized, based on the actual keys
+	join_state.is_build_candidate = true;
+
+	// with propagated statistics
+	if (op.join_stats.empty()) {
+		return;
+	}
 
 	// and when the build range is smaller than the threshold
 	auto &stats_build = *op.join_stats[1].get(); // rhs stats
@@ -106,15 +110,13 @@ void CheckForPerfectJoinOpt(LogicalComparisonJoin &op, PerfectHashJoinStats &joi
 		return;
 	}
 
-	// The max size our build must have to run the perfect HJ
-	const idx_t MAX_BUILD_SIZE = 1000000;
 	join_state.probe_min = NumericStats::Min(stats_probe);
 	join_state.probe_max = NumericStats::Max(stats_probe);
 	join_state.build_min = NumericStats::Min(stats_build);
 	join_state.build_max = NumericStats::Max(stats_build);
 	join_state.estimated_cardinality = op.estimated_cardinality;
 	join_state.build_range = NumericCast<idx_t>(build_range);
-	if (join_state.build_range > MAX_BUILD_SIZE) {
+	if (join_state.build_range > PerfectHashJoinExecutor::MAX_BUILD_SIZE) {
 		return;
 	}
 	if (NumericStats::Min(stats_build) <= NumericStats::Min(stats_probe) &&
@@ -3,6 +3,8 @@
 #include "duckdb/execution/operator/filter/physical_filter.hpp"
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/operator/schema/physical_create_art_index.hpp"
+#include "duckdb/execution/index/bloom_index.hpp"
+#include "duckdb/execution/operator/schema/physical_create_bloom_index.hpp"
 #include "duckdb/execution/operator/order/physical_order.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/planner/operator/logical_create_index.hpp"
@@ -30,6 +32,26 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalCreateInde
 		}
 	}
 
+	if (op.info->index_type == BloomIndex::TYPE_NAME) {
+		// BLOOM indexes mark columns for which every row group builds a bloom filter when it is checkpointed
+		// these can only be used for pruning if the index is on plain columns, and the column data is not nested
+		if (op.info->constraint_type != IndexConstraintType::NONE) {
+			throw BinderException("BLOOM indexes cannot be used to enforce constraints");
+		}
+		for (auto &expr : op.unbound_expressions) {
+			if (expr->type != ExpressionType::BOUND_COLUMN_REF) {
+				throw BinderException("BLOOM indexes can only be created on columns, not on expressions");
+			}
+			if (expr->return_type.IsNested()) {
+				throw BinderException("BLOOM indexes are not supported on columns of type %s",
+				                      expr->return_type.ToString());
+			}
+		}
+		dependencies.AddDependency(op.table);
+		return make_uniq<PhysicalCreateBloomIndex>(op, op.table, op.info->column_ids, std::move(op.info),
+		                                           std::move(op.unbound_expressions), op.estimated_cardinality);
+	}
+
 	// if we get here and the index type is not ART, we throw an exception
 	// because we don't support any other index type yet. However, an operator extension could have
 	// replaced this part of the plan with a different index creation operator.
@@ -139,6 +139,11 @@ public:
 	static constexpr const double BLOCK_FILL_FACTOR = 1.8;
 	//! By how many bits to repartition if a repartition is triggered
 	static constexpr const idx_t REPARTITION_RADIX_BITS = 2;
+
+	//! How many tuples a thread must have sunk before it can decide to skip the lookups in its HT
+	static constexpr const idx_t SKIP_LOOKUP_THRESHOLD = 262144;
+	//! If at least this fraction of the sunk tuples created a new group, the thread skips the lookups in its HT
+	static constexpr const double SKIP_LOOKUP_RATIO = 0.95;
 };
 
 class RadixHTGlobalSinkState : public GlobalSinkState {
@@ -330,6 +335,11 @@ public:
 
 	//! Data that is abandoned ends up here (only if we're doing external aggregation)
 	unique_ptr<PartitionedTupleData> abandoned_data;
+
+	//! Number of tuples that were sunk into the HT
+	idx_t sink_count = 0;
+	//! Number of tuples that created a new group in the HT
+	idx_t new_group_count = 0;
 };
 
 RadixHTLocalSinkState::RadixHTLocalSinkState(ClientContext &, const RadixPartitionedHashTable &radix_ht) {
@@ -449,7 +459,8 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk
 	PopulateGroupChunk(group_chunk, chunk);
 
 	auto &ht = *lstate.ht;
-	ht.AddChunk(group_chunk, payload_input, filter);
+	lstate.new_group_count += ht.AddChunk(group_chunk, payload_input, filter);
+	lstate.sink_count += group_chunk.size();
 
 	if (ht.Count() + STANDARD_VECTOR_SIZE < ht.ResizeThreshold()) {
 		return; // We can fit another chunk
@@ -461,6 +472,15 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk
 		ht.ClearPointerTable();
 		ht.ResetCount();
 		// We don't do this when running with 1 or 2 threads, it only makes sense when there's many threads
+
+		// If almost every tuple creates a new group (e.g., when grouping by a unique key), the HT does not reduce
+		// the data, and we only pay for the lookups. We then append the tuples to the partitions directly instead,
+		// the groups are de-duplicated anyway when the partitions are combined during the Finalize
+		if (lstate.sink_count >= RadixHTConfig::SKIP_LOOKUP_THRESHOLD &&
+		    static_cast<double>(lstate.new_group_count) >=
+		        RadixHTConfig::SKIP_LOOKUP_RATIO * static_cast<double>(lstate.sink_count)) {
+			ht.SkipLookups();
+		}
 	}
 
 	// Check if we need to repartition
@@ -4,6 +4,8 @@
 #include "duckdb/common/operator/subtract.hpp"
 
 #include "duckdb/common/array.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 
 namespace duckdb {
 
@@ -925,12 +927,15 @@ public:
 	bool IsConstantAggregate();
 	bool IsCustomAggregate();
 	bool IsDistinctAggregate();
+	bool IsHaloAggregate();
 
 	WindowAggregateExecutorGlobalState(const WindowAggregateExecutor &executor, const idx_t payload_count,
 	                                   const ValidityMask &partition_mask, const ValidityMask &order_mask);
 
 	// aggregate computation algorithm
 	unique_ptr<WindowAggregator> aggregator;
+	// whether the aggregator is a segment tree
+	bool is_segment_tree = false;
 	// aggregate global state
 	unique_ptr<WindowAggregatorState> gsink;
 };
@@ -1020,10 +1025,123 @@ bool WindowAggregateExecutorGlobalState::IsCustomAggregate() {
 	return (mode < WindowAggregationMode::COMBINE);
 }
 
+static void ApplyWindowStats(const WindowBoundary &boundary, FrameDelta &delta, BaseStatistics *base, bool is_start) {
+	// Avoid overflow by clamping to the frame bounds
+	auto base_stats = delta;
+
+	switch (boundary) {
+	case WindowBoundary::UNBOUNDED_PRECEDING:
+		if (is_start) {
+			delta.end = 0;
+			return;
+		}
+		break;
+	case WindowBoundary::UNBOUNDED_FOLLOWING:
+		if (!is_start) {
+			delta.begin = 0;
+			return;
+		}
+		break;
+	case WindowBoundary::CURRENT_ROW_ROWS:
+		delta.begin = delta.end = 0;
+		return;
+	case WindowBoundary::EXPR_PRECEDING_ROWS:
+		if (base && base->GetStatsType() == StatisticsType::NUMERIC_STATS && NumericStats::HasMinMax(*base)) {
+			//	Preceding so negative offset from current row
+			base_stats.begin = NumericStats::GetMin<int64_t>(*base);
+			base_stats.end = NumericStats::GetMax<int64_t>(*base);
+			if (delta.begin < base_stats.end && base_stats.end < delta.end) {
+				delta.begin = -base_stats.end;
+			}
+			if (delta.begin < base_stats.begin && base_stats.begin < delta.end) {
+				delta.end = -base_stats.begin + 1;
+			}
+		}
+		return;
+	case WindowBoundary::EXPR_FOLLOWING_ROWS:
+		if (base && base->GetStatsType() == StatisticsType::NUMERIC_STATS && NumericStats::HasMinMax(*base)) {
+			base_stats.begin = NumericStats::GetMin<int64_t>(*base);
+			base_stats.end = NumericStats::GetMax<int64_t>(*base);
+			if (base_stats.end < delta.end) {
+				delta.end = base_stats.end + 1;
+			}
+		}
+		return;
+
+	case WindowBoundary::CURRENT_ROW_RANGE:
+	case WindowBoundary::EXPR_PRECEDING_RANGE:
+	case WindowBoundary::EXPR_FOLLOWING_RANGE:
+		return;
+	default:
+		break;
+	}
+
+	if (is_start) {
+		throw InternalException("Unsupported window start boundary");
+	} else {
+		throw InternalException("Unsupported window end boundary");
+	}
+}
+
+bool WindowAggregateExecutorGlobalState::IsHaloAggregate() {
+	const auto &wexpr = executor.wexpr;
+	auto &context = executor.context;
+
+	if (!wexpr.aggregate || !wexpr.aggregate->combine) {
+		return false;
+	}
+
+	//	Unbounded frames need the entire partition
+	if (wexpr.start == WindowBoundary::UNBOUNDED_PRECEDING || wexpr.end == WindowBoundary::UNBOUNDED_FOLLOWING) {
+		return false;
+	}
+
+	//	The arguments are stored in fixed-size blocks
+	if (arg_types.empty()) {
+		return false;
+	}
+	idx_t row_width = 0;
+	for (const auto &arg_type : arg_types) {
+		if (!TypeIsConstantSize(arg_type.InternalType())) {
+			return false;
+		}
+		row_width += GetTypeIdSize(arg_type.InternalType());
+	}
+
+	//	Each thread builds a segment tree over the halo of the rows it evaluates,
+	//	so the frames must be small enough for these trees to fit in memory.
+	//	RANGE frames (or offsets without statistics) can span the entire partition.
+	const auto count = NumericCast<int64_t>(payload_count);
+	FrameStats stats;
+	stats[0] = FrameDelta(-count, count);
+	ApplyWindowStats(wexpr.start, stats[0], wexpr.expr_stats.empty() ? nullptr : wexpr.expr_stats[0].get(), true);
+	stats[1] = FrameDelta(-count, count);
+	ApplyWindowStats(wexpr.end, stats[1], wexpr.expr_stats.empty() ? nullptr : wexpr.expr_stats[1].get(), false);
+	const auto halo_rows = NumericCast<idx_t>(MaxValue<int64_t>(stats[1].end - stats[0].begin, 0));
+	const auto max_memory = BufferManager::GetBufferManager(context).GetQueryMaxMemory();
+	const auto threads = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+	if (halo_rows * row_width > max_memory / (4 * threads)) {
+		return false;
+	}
+
+	if (ClientConfig::GetConfig(context).force_external) {
+		return true;
+	}
+
+	//	Only go out of core if the arguments of the partition take up a large part of the memory,
+	//	which also needs to hold the sorted data and the other functions.
+	return payload_count * row_width > max_memory / 4;
+}
+
 void WindowExecutor::Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &result, WindowExecutorLocalState &lstate,
-                              WindowExecutorGlobalState &gstate) const {
+                              WindowExecutorGlobalState &gstate, optional_ptr<WindowExecutorLocalState> shared) const {
 	auto &lbstate = lstate.Cast<WindowExecutorBoundsState>();
-	lbstate.UpdateBounds(row_idx, input_chunk, gstate.range);
+	if (shared) {
+		//	The bounds of this chunk have already been computed for the same frame
+		lbstate.bounds.Reference(shared->Cast<WindowExecutorBoundsState>().bounds);
+	} else {
+		lbstate.UpdateBounds(row_idx, input_chunk, gstate.range);
+	}
 
 	const auto count = input_chunk.size();
 	EvaluateInternal(gstate, lstate, result, count, row_idx);
@@ -1060,10 +1178,15 @@ WindowAggregateExecutorGlobalState::WindowAggregateExecutorGlobalState(const Win
 		aggregator = make_uniq<WindowConstantAggregator>(aggr, arg_types, return_type, wexpr.exclude_clause);
 	} else if (IsCustomAggregate()) {
 		aggregator = make_uniq<WindowCustomAggregator>(aggr, arg_types, return_type, wexpr.exclude_clause);
+	} else if (IsHaloAggregate()) {
+		// evaluate huge partitions out of core, with a segment tree for each range of rows and its halo
+		aggregator =
+		    make_uniq<WindowHaloAggregator>(aggr, arg_types, return_type, mode, wexpr.exclude_clause, context);
 	} else {
 		// build a segment tree for frame-adhering aggregates
 		// see http://www.vldb.org/pvldb/vol8/p1058-leis.pdf
 		aggregator = make_uniq<WindowSegmentTree>(aggr, arg_types, return_type, mode, wexpr.exclude_clause);
+		is_segment_tree = true;
 	}
 
 	gsink = aggregator->GetGlobalState(group_count, partition_mask);
@@ -1075,6 +1198,14 @@ unique_ptr<WindowExecutorGlobalState> WindowAggregateExecutor::GetGlobalState(co
 	return make_uniq<WindowAggregateExecutorGlobalState>(*this, payload_count, partition_mask, order_mask);
 }
 
+void WindowAggregateExecutor::ShareTree(WindowExecutorGlobalState &gstate, WindowExecutorGlobalState &gshared) {
+	auto &gastate = gstate.Cast<WindowAggregateExecutorGlobalState>();
+	auto &gashared = gshared.Cast<WindowAggregateExecutorGlobalState>();
+	if (gastate.is_segment_tree && gashared.is_segment_tree) {
+		WindowSegmentTree::ShareBuild(*gastate.gsink, *gashared.gsink);
+	}
+}
+
 class WindowAggregateExecutorLocalState : public WindowExecutorBoundsState {
 public:
 	WindowAggregateExecutorLocalState(const WindowExecutorGlobalState &gstate, const WindowAggregator &aggregator)
@@ -1141,64 +1272,6 @@ void WindowAggregateExecutor::Sink(DataChunk &input_chunk, const idx_t input_idx
 	WindowExecutor::Sink(input_chunk, input_idx, total_count, gstate, lstate);
 }
 
-static void ApplyWindowStats(const WindowBoundary &boundary, FrameDelta &delta, BaseStatistics *base, bool is_start) {
-	// Avoid overflow by clamping to the frame bounds
-	auto base_stats = delta;
-
-	switch (boundary) {
-	case WindowBoundary::UNBOUNDED_PRECEDING:
-		if (is_start) {
-			delta.end = 0;
-			return;
-		}
-		break;
-	case WindowBoundary::UNBOUNDED_FOLLOWING:
-		if (!is_start) {
-			delta.begin = 0;
-			return;
-		}
-		break;
-	case WindowBoundary::CURRENT_ROW_ROWS:
-		delta.begin = delta.end = 0;
-		return;
-	case WindowBoundary::EXPR_PRECEDING_ROWS:
-		if (base && base->GetStatsType() == StatisticsType::NUMERIC_STATS && NumericStats::HasMinMax(*base)) {
-			//	Preceding so negative offset from current row
-			base_stats.begin = NumericStats::GetMin<int64_t>(*base);
-			base_stats.end = NumericStats::GetMax<int64_t>(*base);
-			if (delta.begin < base_stats.end && base_stats.end < delta.end) {
-				delta.begin = -base_stats.end;
-			}
-			if (delta.begin < base_stats.begin && base_stats.begin < delta.end) {
-				delta.end = -base_stats.begin + 1;
-			}
-		}
-		return;
-	case WindowBoundary::EXPR_FOLLOWING_ROWS:
-		if (base && base->GetStatsType() == StatisticsType::NUMERIC_STATS && NumericStats::HasMinMax(*base)) {
-			base_stats.begin = NumericStats::GetMin<int64_t>(*base);
-			base_stats.end = NumericStats::GetMax<int64_t>(*base);
-			if (base_stats.end < delta.end) {
-				delta.end = base_stats.end + 1;
-			}
-		}
-		return;
-
-	case WindowBoundary::CURRENT_ROW_RANGE:
-	case WindowBoundary::EXPR_PRECEDING_RANGE:
-	case WindowBoundary::EXPR_FOLLOWING_RANGE:
-		return;
-	default:
-		break;
-	}
-
-	if (is_start) {
-		throw InternalException("Unsupported window start boundary");
-	} else {
-		throw InternalException("Unsupported window end boundary");
-	}
-}
-
 void WindowAggregateExecutor::Finalize(WindowExecutorGlobalState &gstate, WindowExecutorLocalState &lstate) const {
 	auto &gastate = gstate.Cast<WindowAggregateExecutorGlobalState>();
 	auto &aggregator = gastate.aggregator;
@@ -7,6 +7,7 @@
 #include "duckdb/execution/merge_sort_tree.hpp"
 #include "duckdb/planner/expression/bound_constant_expression.hpp"
 #include "duckdb/execution/window_executor.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 
 #include <numeric>
 #include <thread>
@@ -851,6 +852,10 @@ public:
 	//! We need to hold onto them for the tree lifetime,
 	//! not the lifetime of the local state that constructed part of the tree
 	vector<unique_ptr<ArenaAllocator>> tree_allocators;
+	//! The trees of other aggregates over the same frame that are built together with this one
+	vector<reference<WindowSegmentTreeGlobalState>> shared_trees;
+	//! The tree that this tree is built together with
+	optional_ptr<WindowSegmentTreeGlobalState> builder;
 
 	// TREE_FANOUT needs to cleanly divide STANDARD_VECTOR_SIZE
 	static constexpr idx_t TREE_FANOUT = 16;
@@ -950,7 +955,8 @@ void WindowSegmentTree::Finalize(WindowAggregatorState &gsink, WindowAggregatorS
 
 	WindowAggregator::Finalize(gsink, lstate, stats);
 
-	if (inputs.ColumnCount() > 0) {
+	//	Shared trees are built by their builder, which is finalized first
+	if (inputs.ColumnCount() > 0 && !gasink.builder) {
 		if (aggr.function.combine && UseCombineAPI()) {
 			lstate.Cast<WindowSegmentTreeState>().Finalize(gasink);
 		}
@@ -959,6 +965,18 @@ void WindowSegmentTree::Finalize(WindowAggregatorState &gsink, WindowAggregatorS
 	++gasink.finalized;
 }
 
+void WindowSegmentTree::ShareBuild(WindowAggregatorState &gstate, WindowAggregatorState &gshared) {
+	auto &gtstate = gstate.Cast<WindowSegmentTreeGlobalState>();
+	auto &gtshared = gshared.Cast<WindowSegmentTreeGlobalState>();
+	if (!gtstate.tree.BuildsTree() || !gtshared.tree.BuildsTree()) {
+		return;
+	}
+	D_ASSERT(!gtstate.builder && !gtshared.builder);
+	D_ASSERT(gtstate.levels_flat_start == gtshared.levels_flat_start);
+	gtstate.shared_trees.emplace_back(gtshared);
+	gtshared.builder = &gtstate;
+}
+
 WindowSegmentTreePart::WindowSegmentTreePart(ArenaAllocator &allocator, const AggregateObject &aggr,
                                              const DataChunk &inputs, const ValidityArray &filter_mask)
     : allocator(allocator), aggr(aggr),
@@ -1132,6 +1150,14 @@ void WindowSegmentTreeState::Finalize(WindowSegmentTreeGlobalState &gstate) {
 	auto &tree = gstate.tree;
 	auto &filter_mask = gstate.filter_mask;
 	WindowSegmentTreePart gtstate(gstate.CreateTreeAllocator(), tree.aggr, inputs, filter_mask);
+	//	The trees of the other aggregates over the same frame have the same shape,
+	//	so we build their nodes at the same time to synchronise only once per level.
+	vector<unique_ptr<WindowSegmentTreePart>> shared_parts;
+	for (auto &shared_tree : gstate.shared_trees) {
+		auto &gshared = shared_tree.get();
+		shared_parts.emplace_back(make_uniq<WindowSegmentTreePart>(gshared.CreateTreeAllocator(), gshared.tree.aggr,
+		                                                           gshared.inputs, gshared.filter_mask));
+	}
 
 	auto &levels_flat_native = gstate.levels_flat_native;
 	const auto &levels_flat_start = gstate.levels_flat_start;
@@ -1165,10 +1191,17 @@ void WindowSegmentTreeState::Finalize(WindowSegmentTreeGlobalState &gstate) {
 		// compute the aggregate for this entry in the segment tree
 		const idx_t pos = build_idx * gstate.TREE_FANOUT;
 		const idx_t levels_flat_offset = levels_flat_start[level_current] + build_idx;
+		const auto build_end = MinValue(level_size, pos + gstate.TREE_FANOUT);
 		auto state_ptr = levels_flat_native.GetStatePtr(levels_flat_offset);
-		gtstate.WindowSegmentValue(gstate, level_current, pos, MinValue(level_size, pos + gstate.TREE_FANOUT),
-		                           state_ptr);
+		gtstate.WindowSegmentValue(gstate, level_current, pos, build_end, state_ptr);
 		gtstate.FlushStates(level_current > 0);
+		for (idx_t shared_idx = 0; shared_idx < shared_parts.size(); ++shared_idx) {
+			auto &gshared = gstate.shared_trees[shared_idx].get();
+			auto &shared_part = *shared_parts[shared_idx];
+			state_ptr = gshared.levels_flat_native.GetStatePtr(levels_flat_offset);
+			shared_part.WindowSegmentValue(gshared, level_current, pos, build_end, state_ptr);
+			shared_part.FlushStates(level_current > 0);
+		}
 
 		//	If that was the last one, mark the level as complete.
 		const idx_t build_complete = ++(*gstate.build_completed).at(level_current);
@@ -1390,6 +1423,273 @@ void WindowSegmentTreePart::EvaluateLeaves(const WindowSegmentTreeGlobalState &t
 	FlushStates(false);
 }
 
+//===--------------------------------------------------------------------===//
+// WindowHaloAggregator
+//===--------------------------------------------------------------------===//
+WindowHaloAggregator::WindowHaloAggregator(AggregateObject aggr, const vector<LogicalType> &arg_types,
+                                           const LogicalType &result_type, WindowAggregationMode mode,
+                                           const WindowExcludeMode exclude_mode_p, ClientContext &context)
+    : WindowAggregator(aggr, arg_types, result_type, exclude_mode_p),
+      tree(std::move(aggr), arg_types, result_type, mode, exclude_mode_p), context(context) {
+}
+
+class WindowHaloAggregatorGlobalState : public WindowAggregatorState {
+public:
+	WindowHaloAggregatorGlobalState(const WindowHaloAggregator &aggregator, idx_t group_count,
+	                                const ValidityMask &partition_mask);
+
+	//! Pin the block with the given index, allocating it if needed
+	BufferHandle GetBlock(idx_t block_idx);
+	//! Pin the (sunk) block with the given index
+	BufferHandle PinBlock(idx_t block_idx) const;
+	//! Store the arguments of the rows starting at input_idx
+	void Sink(DataChunk &arg_chunk, idx_t input_idx, optional_ptr<SelectionVector> filter_sel, idx_t filtered);
+	//! Load the arguments of the rows [begin, end) into a segment tree
+	void Load(idx_t begin, idx_t end, DataChunk &inputs, ValidityArray &filter_mask) const;
+
+	//! The aggregator data
+	const WindowHaloAggregator &aggregator;
+	//! The buffer manager that can evict the blocks
+	BufferManager &buffer_manager;
+	//! The number of rows in the partition
+	const idx_t group_count;
+	//! The partition boundaries
+	const ValidityMask &partition_mask;
+	//! The offsets of the argument columns in a block
+	vector<idx_t> column_offsets;
+	//! The offsets of the validity bytes of the argument columns in a block
+	vector<idx_t> validity_offsets;
+	//! The offset of the filter bytes in a block
+	idx_t filter_offset;
+	//! The size of a block
+	idx_t block_size;
+	//! Lock for allocating the blocks
+	mutex lock;
+	//! The blocks of BLOCK_ROWS rows each
+	vector<shared_ptr<BlockHandle>> blocks;
+
+	//! The number of rows in a block
+	static constexpr idx_t BLOCK_ROWS = 16 * STANDARD_VECTOR_SIZE;
+};
+
+WindowHaloAggregatorGlobalState::WindowHaloAggregatorGlobalState(const WindowHaloAggregator &aggregator,
+                                                                 idx_t group_count, const ValidityMask &partition_mask)
+    : aggregator(aggregator), buffer_manager(BufferManager::GetBufferManager(aggregator.context)),
+      group_count(group_count), partition_mask(partition_mask) {
+	//	Each column is stored as its values followed by a validity byte per row,
+	//	so threads sinking neighbouring rows never write to the same byte.
+	block_size = 0;
+	for (auto &arg_type : aggregator.arg_types) {
+		column_offsets.emplace_back(block_size);
+		block_size += BLOCK_ROWS * GetTypeIdSize(arg_type.InternalType());
+		validity_offsets.emplace_back(block_size);
+		block_size += BLOCK_ROWS;
+	}
+	filter_offset = block_size;
+	if (aggregator.aggr.filter) {
+		block_size += BLOCK_ROWS;
+	}
+
+	blocks.resize((group_count + BLOCK_ROWS - 1) / BLOCK_ROWS);
+}
+
+BufferHandle WindowHaloAggregatorGlobalState::GetBlock(idx_t block_idx) {
+	shared_ptr<BlockHandle> block;
+	{
+		lock_guard<mutex> guard(lock);
+		if (!blocks[block_idx]) {
+			auto handle = buffer_manager.Allocate(MemoryTag::ORDER_BY, block_size, false);
+			blocks[block_idx] = handle.GetBlockHandle();
+			return handle;
+		}
+		block = blocks[block_idx];
+	}
+	return buffer_manager.Pin(block);
+}
+
+BufferHandle WindowHaloAggregatorGlobalState::PinBlock(idx_t block_idx) const {
+	//	All the blocks have been allocated by the time we evaluate
+	auto block = blocks[block_idx];
+	D_ASSERT(block);
+	return buffer_manager.Pin(block);
+}
+
+void WindowHaloAggregatorGlobalState::Sink(DataChunk &arg_chunk, idx_t input_idx,
+                                           optional_ptr<SelectionVector> filter_sel, idx_t filtered) {
+	const auto count = arg_chunk.size();
+	vector<UnifiedVectorFormat> sdata(arg_chunk.ColumnCount());
+	for (idx_t col_idx = 0; col_idx < arg_chunk.ColumnCount(); ++col_idx) {
+		arg_chunk.data[col_idx].ToUnifiedFormat(count, sdata[col_idx]);
+	}
+
+	uint8_t passed[STANDARD_VECTOR_SIZE];
+	if (filter_sel) {
+		memset(passed, 0, count);
+		for (idx_t f = 0; f < filtered; ++f) {
+			passed[filter_sel->get_index(f)] = 1;
+		}
+	}
+
+	for (idx_t begin = 0; begin < count;) {
+		const auto row_idx = input_idx + begin;
+		const auto block_row = row_idx % BLOCK_ROWS;
+		const auto block_count = MinValue(count - begin, BLOCK_ROWS - block_row);
+		auto handle = GetBlock(row_idx / BLOCK_ROWS);
+		auto block_ptr = handle.Ptr();
+
+		for (idx_t col_idx = 0; col_idx < sdata.size(); ++col_idx) {
+			const auto &format = sdata[col_idx];
+			const auto type_size = GetTypeIdSize(arg_chunk.data[col_idx].GetType().InternalType());
+			auto data_ptr = block_ptr + column_offsets[col_idx] + block_row * type_size;
+			auto validity_ptr = block_ptr + validity_offsets[col_idx] + block_row;
+			for (idx_t i = 0; i < block_count; ++i) {
+				const auto idx = format.sel->get_index(begin + i);
+				memcpy(data_ptr + i * type_size, format.data + idx * type_size, type_size);
+				validity_ptr[i] = format.validity.RowIsValid(idx);
+			}
+		}
+
+		if (filter_sel) {
+			memcpy(block_ptr + filter_offset + block_row, passed + begin, block_count);
+		}
+
+		begin += block_count;
+	}
+}
+
+void WindowHaloAggregatorGlobalState::Load(idx_t begin, idx_t end, DataChunk &inputs,
+                                           ValidityArray &filter_mask) const {
+	for (idx_t row_idx = begin; row_idx < end;) {
+		const auto block_row = row_idx % BLOCK_ROWS;
+		const auto block_count = MinValue(end - row_idx, BLOCK_ROWS - block_row);
+		auto handle = PinBlock(row_idx / BLOCK_ROWS);
+		auto block_ptr = handle.Ptr();
+
+		const auto offset = row_idx - begin;
+		for (idx_t col_idx = 0; col_idx < inputs.ColumnCount(); ++col_idx) {
+			auto &target = inputs.data[col_idx];
+			const auto type_size = GetTypeIdSize(target.GetType().InternalType());
+			auto data_ptr = block_ptr + column_offsets[col_idx] + block_row * type_size;
+			memcpy(FlatVector::GetData(target) + offset * type_size, data_ptr, block_count * type_size);
+
+			auto validity_ptr = block_ptr + validity_offsets[col_idx] + block_row;
+			auto &validity = FlatVector::Validity(target);
+			for (idx_t i = 0; i < block_count; ++i) {
+				if (!validity_ptr[i]) {
+					validity.SetInvalid(offset + i);
+				}
+			}
+		}
+
+		if (aggregator.aggr.filter) {
+			auto filter_ptr = block_ptr + filter_offset + block_row;
+			for (idx_t i = 0; i < block_count; ++i) {
+				if (filter_ptr[i]) {
+					filter_mask.SetValid(offset + i);
+				}
+			}
+		}
+
+		row_idx += block_count;
+	}
+}
+
+class WindowHaloAggregatorLocalState : public WindowAggregatorState {
+public:
+	WindowHaloAggregatorLocalState() : halo_begin(0), halo_end(0) {
+		vector<LogicalType> bounds_types(6, LogicalType(LogicalTypeId::UBIGINT));
+		bounds.Initialize(Allocator::DefaultAllocator(), bounds_types);
+	}
+
+	void Evaluate(const WindowHaloAggregatorGlobalState &ghstate, const DataChunk &bounds, Vector &result,
+	              idx_t count, idx_t row_idx);
+
+	//! The first row in the halo tree
+	idx_t halo_begin;
+	//! The row after the last row in the halo tree
+	idx_t halo_end;
+	//! The segment tree over the halo
+	unique_ptr<WindowAggregatorState> halo_tree;
+	//! The evaluation state of the halo tree
+	unique_ptr<WindowAggregatorState> halo_state;
+	//! The bounds relative to the start of the halo
+	DataChunk bounds;
+
+	//! The number of following rows in a halo tree, so it can be reused by the next chunks
+	static constexpr idx_t HALO_ROWS = 8 * STANDARD_VECTOR_SIZE;
+};
+
+void WindowHaloAggregatorLocalState::Evaluate(const WindowHaloAggregatorGlobalState &ghstate,
+                                              const DataChunk &source_bounds, Vector &result, idx_t count,
+                                              idx_t row_idx) {
+	static const WindowBounds frame_columns[] = {WINDOW_BEGIN, WINDOW_END, PEER_BEGIN, PEER_END};
+	//	The peer boundaries are only computed (and used) when excluding peers
+	const auto &tree = ghstate.aggregator.tree;
+	const idx_t frame_count = (tree.exclude_mode >= WindowExcludeMode::GROUP) ? 4 : 2;
+
+	//	Find the rows needed by the frames of this chunk (including the chunk itself for exclusions)
+	idx_t begin = row_idx;
+	idx_t end = row_idx + count;
+	for (idx_t c = 0; c < frame_count; ++c) {
+		auto frame_data = FlatVector::GetData<const idx_t>(source_bounds.data[frame_columns[c]]);
+		for (idx_t i = 0; i < count; ++i) {
+			begin = MinValue(begin, frame_data[i]);
+			end = MaxValue(end, frame_data[i]);
+		}
+	}
+
+	if (!halo_tree || begin < halo_begin || end > halo_end) {
+		//	Build a new tree from the blocks. We usually move forward through the partition,
+		//	so we include the following rows to reuse the tree for the next chunks.
+		halo_begin = begin;
+		halo_end = MinValue(end + HALO_ROWS, ghstate.group_count);
+		halo_state.reset();
+		halo_tree = tree.GetGlobalState(halo_end - halo_begin, ghstate.partition_mask);
+		auto &gtstate = halo_tree->Cast<WindowSegmentTreeGlobalState>();
+		ghstate.Load(halo_begin, halo_end, gtstate.inputs, gtstate.filter_mask);
+
+		if (tree.BuildsTree()) {
+			WindowSegmentTreeState builder;
+			builder.Finalize(gtstate);
+		}
+		halo_state = tree.GetLocalState(*halo_tree);
+	}
+
+	//	Evaluate the frames relative to the halo
+	bounds.Reset();
+	for (idx_t c = 0; c < frame_count; ++c) {
+		auto frame_data = FlatVector::GetData<const idx_t>(source_bounds.data[frame_columns[c]]);
+		auto halo_data = FlatVector::GetData<idx_t>(bounds.data[frame_columns[c]]);
+		for (idx_t i = 0; i < count; ++i) {
+			halo_data[i] = frame_data[i] - halo_begin;
+		}
+	}
+	bounds.SetCardinality(count);
+	tree.Evaluate(*halo_tree, *halo_state, bounds, result, count, row_idx - halo_begin);
+}
+
+unique_ptr<WindowAggregatorState> WindowHaloAggregator::GetGlobalState(idx_t group_count,
+                                                                       const ValidityMask &partition_mask) const {
+	return make_uniq<WindowHaloAggregatorGlobalState>(*this, group_count, partition_mask);
+}
+
+void WindowHaloAggregator::Sink(WindowAggregatorState &gsink, WindowAggregatorState &lstate, DataChunk &arg_chunk,
+                                idx_t input_idx, optional_ptr<SelectionVector> filter_sel, idx_t filtered) {
+	auto &ghstate = gsink.Cast<WindowHaloAggregatorGlobalState>();
+	ghstate.Sink(arg_chunk, input_idx, filter_sel, filtered);
+}
+
+unique_ptr<WindowAggregatorState> WindowHaloAggregator::GetLocalState(const WindowAggregatorState &gstate) const {
+	return make_uniq<WindowHaloAggregatorLocalState>();
+}
+
+void WindowHaloAggregator::Evaluate(const WindowAggregatorState &gsink, WindowAggregatorState &lstate,
+                                    const DataChunk &bounds, Vector &result, idx_t count, idx_t row_idx) const {
+	const auto &ghstate = gsink.Cast<WindowHaloAggregatorGlobalState>();
+	auto &lhstate = lstate.Cast<WindowHaloAggregatorLocalState>();
+	lhstate.Evaluate(ghstate, bounds, result, count, row_idx);
+}
+
 //===--------------------------------------------------------------------===//
 // WindowDistinctAggregator
 //===--------------------------------------------------------------------===//
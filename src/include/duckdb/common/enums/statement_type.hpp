@@ -67,7 +67,8 @@ class ClientContext;
 struct StatementProperties {
 	StatementProperties()
 	    : requires_valid_transaction(true), allow_stream_result(false), bound_all_parameters(true),
-	      return_type(StatementReturnType::QUERY_RESULT), parameter_count(0), always_require_rebind(false) {
+	      return_type(StatementReturnType::QUERY_RESULT), parameter_count(0), always_require_rebind(false),
+	      is_consistent(false) {
 	}
 
 	struct CatalogIdentity {
@@ -100,6 +101,9 @@ struct StatementProperties {
 	idx_t parameter_count;
 	//! Whether or not the statement ALWAYS requires a rebind
 	bool always_require_rebind;
+	//! Whether or not the statement gives the same result every time it runs on the same data, i.e., it only reads
+	//! from tables and has no volatile or time-dependent expressions (only determined if the result cache is enabled)
+	bool is_consistent;
 
 	bool IsReadOnly() {
 		return modified_databases.empty();
@@ -24,7 +24,7 @@ class FileBuffer {
 public:
 	//! Allocates a buffer of the specified size, with room for additional header bytes
 	//! (typically 8 bytes). On return, this->AllocSize() >= this->size >= user_size.
-	//! Our allocation size will always be page-aligned, which is necessary to support
+	//! Our allocation size and the start of the buffer will always be page-aligned, which is necessary to support
 	//! DIRECT_IO
 	FileBuffer(Allocator &allocator, FileBufferType type, uint64_t user_size);
 	FileBuffer(FileBuffer &source, FileBufferType type);
@@ -72,6 +72,11 @@ protected:
 	data_ptr_t internal_buffer;
 	//! The aligned size as passed to the constructor. This is the size that is read or written to disk.
 	uint64_t internal_size;
+	//! The allocation that holds the internal buffer. If the allocator does not return sector-aligned memory we
+	//! over-allocate, and the internal buffer starts at the first aligned address within the allocation.
+	data_ptr_t allocation;
+	//! The size of the allocation
+	uint64_t allocation_size;
 
 	void ReallocBuffer(size_t malloc_size);
 	void Init();
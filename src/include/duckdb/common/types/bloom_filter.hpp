@@ -0,0 +1,98 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/types/bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+namespace duckdb {
+class Serializer;
+class Deserializer;
+
+//! A split-block Bloom filter over the hashes produced by VectorOperations::Hash
+//! "Cache-, Hash- and Space-Efficient Bloom Filters", Putze et al. (the same layout is used by Parquet)
+//! Every key sets one bit in each of the eight 32-bit words of a single 256-bit block, so that inserting or looking up
+//! a key touches only one cache line, and the eight probes can be evaluated with SIMD instructions
+class BloomFilter {
+public:
+	static constexpr idx_t WORDS_PER_BLOCK = 8;
+	static constexpr idx_t BLOCK_SIZE = WORDS_PER_BLOCK * sizeof(uint32_t);
+	//! Bits reserved per expected key, which keeps the false positive rate well below 1%
+	static constexpr idx_t BITS_PER_KEY = 16;
+	//! Bits per key of the bloom filters that are stored along with the column data, for a false positive rate of ~1%
+	static constexpr idx_t STORAGE_BITS_PER_KEY = 12;
+	//! The maximum amount of blocks (16MB) - keys beyond the capacity of this increase the false positive rate
+	static constexpr idx_t MAX_BLOCK_COUNT = 524288;
+	//! The maximum amount of keys that fit in a filter of the maximum size without exceeding BITS_PER_KEY
+	static constexpr idx_t MAX_KEY_COUNT = MAX_BLOCK_COUNT * BLOCK_SIZE * 8 / BITS_PER_KEY;
+
+public:
+	//! Creates an empty bloom filter sized for "expected_count" distinct keys
+	explicit BloomFilter(idx_t expected_count, idx_t bits_per_key = BITS_PER_KEY);
+
+	//! Inserts a hash into the filter
+	inline void Insert(hash_t hash) {
+		const auto block = GetBlock(hash);
+		const auto key = static_cast<uint32_t>(hash);
+		for (idx_t i = 0; i < WORDS_PER_BLOCK; i++) {
+			block[i] |= GetMask(key, i);
+		}
+	}
+
+	//! Returns false if the hash is definitely not in the filter, true if it might be
+	inline bool Lookup(hash_t hash) const {
+		const auto block = GetBlock(hash);
+		const auto key = static_cast<uint32_t>(hash);
+		uint32_t missing = 0;
+		for (idx_t i = 0; i < WORDS_PER_BLOCK; i++) {
+			missing |= ~block[i] & GetMask(key, i);
+		}
+		return missing == 0;
+	}
+
+public:
+	//! Inserts "count" hashes, "parallel" must be set if multiple threads insert into this filter concurrently
+	void Insert(const hash_t *hashes, idx_t count, bool parallel);
+	//! Hashes the rows in "sel" of "input" (which has "count" rows), and keeps only the non-NULL rows that might be in
+	//! the filter
+	idx_t Filter(Vector &input, idx_t count, SelectionVector &sel, idx_t &approved_tuple_count) const;
+
+	idx_t BlockCount() const {
+		return block_count;
+	}
+	idx_t SizeInBytes() const {
+		return block_count * BLOCK_SIZE;
+	}
+
+	void Serialize(Serializer &serializer) const;
+	static unique_ptr<BloomFilter> Deserialize(Deserializer &deserializer);
+
+private:
+	BloomFilter() : block_count(0) {
+	}
+
+	inline uint32_t *GetBlock(hash_t hash) const {
+		// use the upper bits to select the block (multiply-shift avoids requiring a power of two block count)
+		const auto block_idx = ((hash >> 32) * block_count) >> 32;
+		return blocks.get() + block_idx * WORDS_PER_BLOCK;
+	}
+
+	static inline uint32_t GetMask(uint32_t key, idx_t word_idx) {
+		return uint32_t(1) << ((key * SALT[word_idx]) >> 27);
+	}
+
+private:
+	static constexpr const uint32_t SALT[WORDS_PER_BLOCK] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+	                                                          0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+	idx_t block_count;
+	unsafe_unique_array<uint32_t> blocks;
+};
+
+} // namespace duckdb
@@ -85,6 +85,9 @@ public:
 	void ClearPointerTable();
 	//! Resets the group count to 0
 	void ResetCount();
+	//! Stop looking up groups in the pointer table: from now on, every row is appended as a new group
+	//! The groups are no longer de-duplicated by this HT, so this may only be used if the data is combined later
+	void SkipLookups();
 	//! Set the radix bits for this HT
 	void SetRadixBits(idx_t radix_bits);
 	//! Initializes the PartitionedTupleData
@@ -128,6 +131,8 @@ private:
 
 	//! The number of groups in the HT
 	idx_t count;
+	//! Whether we append every row as a new group without looking it up
+	bool skip_lookups;
 	//! The capacity of the HT. This can be increased using GroupedAggregateHashTable::Resize
 	idx_t capacity;
 	//! The hash map (pointer table) of the HT: allocated data and pointer into it
@@ -0,0 +1,51 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/index/bloom_index.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/index/bound_index.hpp"
+
+namespace duckdb {
+
+//! A BLOOM index does not hold any data itself: it marks its columns, for which every row group builds a bloom filter
+//! over its values when it is checkpointed. The bloom filters are stored along with the column metadata, and used to
+//! skip row groups on equality and IN predicates, which min/max statistics cannot prune for high-cardinality columns
+class BloomIndex : public BoundIndex {
+public:
+	//! Index type name for the BLOOM index.
+	static constexpr const char *TYPE_NAME = "BLOOM";
+
+public:
+	BloomIndex(const string &name, const vector<column_t> &column_ids, TableIOManager &table_io_manager,
+	           const vector<unique_ptr<Expression>> &unbound_expressions, AttachedDatabase &db);
+
+	//! Create a index instance of this type.
+	static unique_ptr<BoundIndex> Create(CreateIndexInput &input);
+
+public:
+	ErrorData Append(IndexLock &lock, DataChunk &entries, Vector &row_identifiers) override;
+	void VerifyAppend(DataChunk &chunk) override;
+	void VerifyAppend(DataChunk &chunk, ConflictManager &conflict_manager) override;
+	void CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_manager) override;
+
+	void CommitDrop(IndexLock &index_lock) override;
+	void Delete(IndexLock &lock, DataChunk &entries, Vector &row_identifiers) override;
+	ErrorData Insert(IndexLock &lock, DataChunk &input, Vector &row_identifiers) override;
+	bool MergeIndexes(IndexLock &state, BoundIndex &other_index) override;
+	void Vacuum(IndexLock &state) override;
+
+	idx_t GetInMemorySize(IndexLock &state) override;
+	string VerifyAndToString(IndexLock &state, const bool only_verify) override;
+	void VerifyAllocations(IndexLock &state) override;
+
+	IndexStorageInfo GetStorageInfo(const case_insensitive_map_t<Value> &options, const bool to_wal) override;
+	string GetConstraintViolationMessage(VerifyExistenceType verify_type, idx_t failed_index,
+	                                     DataChunk &input) override;
+};
+
+} // namespace duckdb
@@ -21,6 +21,7 @@
 
 namespace duckdb {
 
+class BloomFilter;
 class BufferManager;
 class BufferHandle;
 class ColumnDataCollection;
@@ -143,8 +144,13 @@ public:
 		Vector salt_v;
 		Vector ht_offsets_v;
 		Vector ht_offsets_dense_v;
+		//! The gathered entries and salts of the rows that are being probed, so their salts can be compared with SIMD
+		Vector entries_dense_v;
+		Vector salts_dense_v;
+		Vector salt_matches_v;
 
 		SelectionVector non_empty_sel;
+		SelectionVector salt_no_match_sel;
 	};
 
 	struct InsertState : SharedState {
@@ -167,12 +173,15 @@ public:
 	void Merge(JoinHashTable &other);
 	//! Combines the partitions in sink_collection into data_collection, as if it were not partitioned
 	void Unpartition();
-	//! Initialize the pointer table for the probe
-	void InitializePointerTable();
+	//! Allocate the pointer table for the probe
+	void AllocatePointerTable();
+	//! Initialize the pointer table for the probe, this can be done in parallel for different ranges of entries
+	void InitializePointerTable(idx_t entry_idx_from, idx_t entry_idx_to);
 	//! Finalize the build of the HT, constructing the actual hash table and making the HT ready for probing.
 	//! Finalize must be called before any call to Probe, and after Finalize is called Build should no longer be
-	//! ever called.
-	void Finalize(idx_t chunk_idx_from, idx_t chunk_idx_to, bool parallel);
+	//! ever called. If a bloom filter is passed, the hashes of the inserted rows are added to it as well.
+	void Finalize(idx_t chunk_idx_from, idx_t chunk_idx_to, bool parallel,
+	              optional_ptr<BloomFilter> bloom_filter = nullptr);
 	//! Probe the HT with the given input chunk, resulting in the given result
 	void Probe(ScanStructure &scan_structure, DataChunk &keys, TupleDataChunkState &key_state, ProbeState &probe_state,
 	           optional_ptr<Vector> precomputed_hashes = nullptr);
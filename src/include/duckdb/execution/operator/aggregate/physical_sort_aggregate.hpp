@@ -0,0 +1,83 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/aggregate/physical_sort_aggregate.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/operator/aggregate/aggregate_object.hpp"
+#include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/parallel/pipeline.hpp"
+#include "duckdb/planner/bound_query_node.hpp"
+
+namespace duckdb {
+
+class SortAggregateGlobalSinkState;
+
+//! PhysicalSortAggregate performs a group-by and aggregation by sorting the input on the groups and aggregating the
+//! runs of equal groups while scanning the sorted data. Unlike the hash aggregate, it only ever needs to keep the
+//! states of a single vector of groups in memory, which makes it suitable for very large numbers of groups.
+class PhysicalSortAggregate : public PhysicalOperator {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::SORT_GROUP_BY;
+
+public:
+	PhysicalSortAggregate(ClientContext &context, vector<LogicalType> types, vector<unique_ptr<Expression>> aggregates,
+	                      vector<unique_ptr<Expression>> groups, idx_t estimated_cardinality);
+
+	//! The groups
+	vector<unique_ptr<Expression>> groups;
+	//! The aggregates that have to be computed
+	vector<unique_ptr<Expression>> aggregates;
+
+	//! The order by which the input is sorted (the groups, ascending)
+	vector<BoundOrderByNode> orders;
+	//! The aggregates to be computed
+	vector<AggregateObject> aggregate_objects;
+
+public:
+	//! Whether or not the sort aggregate can compute the given aggregates
+	static bool CanAggregate(const vector<unique_ptr<Expression>> &aggregates);
+
+public:
+	// Source interface
+	unique_ptr<GlobalSourceState> GetGlobalSourceState(ClientContext &context) const override;
+	SourceResultType GetData(ExecutionContext &context, DataChunk &chunk, OperatorSourceInput &input) const override;
+
+	bool IsSource() const override {
+		return true;
+	}
+	OrderPreservationType SourceOrder() const override {
+		return OrderPreservationType::NO_ORDER;
+	}
+
+public:
+	// Sink interface
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
+	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
+	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
+	SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
+	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+	                          OperatorSinkFinalizeInput &input) const override;
+
+	bool IsSink() const override {
+		return true;
+	}
+	bool ParallelSink() const override {
+		return true;
+	}
+	bool SinkOrderDependent() const override {
+		return false;
+	}
+
+public:
+	InsertionOrderPreservingMap<string> ParamsToString() const override;
+
+	//! Schedules tasks to merge the sorted runs during the Finalize phase
+	static void ScheduleMergeTasks(Pipeline &pipeline, Event &event, SortAggregateGlobalSinkState &state);
+};
+
+} // namespace duckdb
@@ -8,13 +8,16 @@
 
 #pragma once
 
+#include "duckdb/common/optional_idx.hpp"
 #include "duckdb/planner/expression.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/planner/column_binding.hpp"
 
 namespace duckdb {
+class BloomFilter;
 class DataChunk;
 class DynamicTableFilterSet;
+class JoinHashTable;
 struct GlobalUngroupedAggregateState;
 struct LocalUngroupedAggregateState;
 
@@ -23,6 +26,8 @@ struct JoinFilterPushdownColumn {
 	idx_t join_condition;
 	//! The probe column index to which this filter should be applied
 	ColumnBinding probe_column_index;
+	//! The dynamic table filter set of the scan to push the filter into
+	shared_ptr<DynamicTableFilterSet> dynamic_filters;
 };
 
 struct JoinFilterGlobalState {
@@ -30,6 +35,10 @@ struct JoinFilterGlobalState {
 
 	//! Global Min/Max aggregates for filter pushdown
 	unique_ptr<GlobalUngroupedAggregateState> global_aggregate_state;
+	//! The filter for which a bloom filter should be built (if any)
+	optional_idx bloom_filter_idx;
+	//! The bloom filter over the build-side keys, populated while the hash table is finalized
+	shared_ptr<BloomFilter> bloom_filter;
 };
 
 struct JoinFilterLocalState {
@@ -40,10 +49,14 @@ struct JoinFilterLocalState {
 };
 
 struct JoinFilterPushdownInfo {
-	//! The dynamic table filter set where to push filters into
-	shared_ptr<DynamicTableFilterSet> dynamic_filters;
+	//! Build sides with at most this many rows push the exact set of (sparse) keys as an IN filter
+	static constexpr const idx_t IN_FILTER_THRESHOLD = 512;
+
 	//! The filters that we should generate
 	vector<JoinFilterPushdownColumn> filters;
+	//! Whether any of the filters is pushed into a scan in another pipeline than the probe side of the join (e.g., the
+	//! build side of another join), which should then wait for the build side of this join to be finished
+	bool crosses_pipelines = false;
 	//! Min/Max aggregates
 	vector<unique_ptr<Expression>> min_max_aggregates;
 
@@ -53,7 +66,11 @@ public:
 
 	void Sink(DataChunk &chunk, JoinFilterLocalState &lstate) const;
 	void Combine(JoinFilterGlobalState &gstate, JoinFilterLocalState &lstate) const;
-	void PushFilters(JoinFilterGlobalState &gstate, const PhysicalOperator &op) const;
+	void PushFilters(JoinFilterGlobalState &gstate, const PhysicalOperator &op, JoinHashTable &ht) const;
+	//! Initialize the bloom filter (if PushFilters decided one should be built) that the build side is inserted into
+	void InitializeBloomFilter(JoinFilterGlobalState &gstate, idx_t build_count) const;
+	//! Push the (populated) bloom filter into the probe side
+	void PushBloomFilter(JoinFilterGlobalState &gstate, const PhysicalOperator &op) const;
 };
 
 } // namespace duckdb
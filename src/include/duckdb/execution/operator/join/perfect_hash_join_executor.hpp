@@ -25,6 +25,8 @@ struct PerfectHashJoinStats {
 	Value probe_min;
 	Value probe_max;
 	bool is_build_small = false;
+	//! Whether the join keys allow a perfect hash join, even if the statistics cannot show that the build is small
+	bool is_build_candidate = false;
 	bool is_build_dense = false;
 	bool is_probe_in_domain = false;
 	idx_t build_range = 0;
@@ -35,6 +37,13 @@ struct PerfectHashJoinStats {
 class PerfectHashJoinExecutor {
 	using PerfectHashTable = vector<Vector>;
 
+public:
+	//! The maximum build range (max - min) of a perfect hash join
+	static constexpr const idx_t MAX_BUILD_SIZE = 1000000;
+	//! If the statistics cannot show that the build is small, the build range can be at most this factor times the
+	//! number of build keys (so that we do not allocate a large perfect hash table for a few sparse keys)
+	static constexpr const idx_t MAX_BUILD_SPARSITY = 8;
+
 public:
 	explicit PerfectHashJoinExecutor(const PhysicalHashJoin &join, JoinHashTable &ht, PerfectHashJoinStats pjoin_stats);
 
@@ -59,6 +68,10 @@ private:
 	bool TemplatedFillSelectionVectorBuild(Vector &source, SelectionVector &sel_vec, SelectionVector &seq_sel_vec,
 	                                       idx_t count);
 	bool FullScanHashTable(LogicalType &key_type);
+	//! Sets the build min/max/range to those of the keys in the hash table, returns false if the range is too large
+	bool SetBuildRange(Vector &build_vector, idx_t count);
+	template <typename T>
+	bool TemplatedSetBuildRange(Vector &build_vector, idx_t count);
 
 private:
 	const PhysicalHashJoin &join;
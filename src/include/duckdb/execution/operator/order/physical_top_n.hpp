@@ -10,6 +10,7 @@
 
 #include "duckdb/execution/physical_operator.hpp"
 #include "duckdb/planner/bound_query_node.hpp"
+#include "duckdb/planner/table_filter.hpp"
 
 namespace duckdb {
 
@@ -26,6 +27,10 @@ public:
 	vector<BoundOrderByNode> orders;
 	idx_t limit;
 	idx_t offset;
+	//! The dynamic filters of the scan that the boundary value of the first ordering column is pushed into (if any)
+	shared_ptr<DynamicTableFilterSet> dynamic_filters;
+	//! The column index of the scan that the boundary value is pushed into
+	idx_t dynamic_filter_column = DConstants::INVALID_INDEX;
 
 public:
 	// Source interface
@@ -197,8 +197,9 @@ public:
 	virtual void Finalize(WindowExecutorGlobalState &gstate, WindowExecutorLocalState &lstate) const {
 	}
 
+	//! Evaluates the function, reusing the frame bounds of the shared local state for this chunk if it is given
 	void Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &result, WindowExecutorLocalState &lstate,
-	              WindowExecutorGlobalState &gstate) const;
+	              WindowExecutorGlobalState &gstate, optional_ptr<WindowExecutorLocalState> shared = nullptr) const;
 
 	// The function
 	const BoundWindowExpression &wexpr;
@@ -221,6 +222,9 @@ public:
 	                                                     const ValidityMask &order_mask) const override;
 	unique_ptr<WindowExecutorLocalState> GetLocalState(const WindowExecutorGlobalState &gstate) const override;
 
+	//! Build the segment tree of an aggregate over the same frame together with the one of this aggregate
+	static void ShareTree(WindowExecutorGlobalState &gstate, WindowExecutorGlobalState &gshared);
+
 	const WindowAggregationMode mode;
 
 protected:
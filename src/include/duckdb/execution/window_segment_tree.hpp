@@ -130,16 +130,48 @@ public:
 	void Evaluate(const WindowAggregatorState &gstate, WindowAggregatorState &lstate, const DataChunk &bounds,
 	              Vector &result, idx_t count, idx_t row_idx) const override;
 
+	//! Build the tree in gshared, which has the same size, during the construction of the tree in gstate
+	static void ShareBuild(WindowAggregatorState &gstate, WindowAggregatorState &gshared);
+
 public:
 	//! Use the combine API, if available
 	inline bool UseCombineAPI() const {
 		return mode < WindowAggregationMode::SEPARATE;
 	}
+	//! Whether the tree levels are built at all
+	inline bool BuildsTree() const {
+		return !arg_types.empty() && aggr.function.combine && UseCombineAPI();
+	}
 
 	//! Use the combine API, if available
 	WindowAggregationMode mode;
 };
 
+//! Evaluates bounded frames over partitions that are too large to materialise in memory.
+//! The arguments are stored in blocks that the buffer manager can evict, and each range of rows is evaluated
+//! with a small segment tree over those rows and the frame-sized halo of rows around them.
+class WindowHaloAggregator : public WindowAggregator {
+public:
+	WindowHaloAggregator(AggregateObject aggr, const vector<LogicalType> &arg_types_p, const LogicalType &result_type_p,
+	                     WindowAggregationMode mode_p, const WindowExcludeMode exclude_mode_p, ClientContext &context);
+
+	//	Build
+	unique_ptr<WindowAggregatorState> GetGlobalState(idx_t group_count,
+	                                                 const ValidityMask &partition_mask) const override;
+	void Sink(WindowAggregatorState &gsink, WindowAggregatorState &lstate, DataChunk &arg_chunk, idx_t input_idx,
+	          optional_ptr<SelectionVector> filter_sel, idx_t filtered) override;
+
+	//	Evaluate
+	unique_ptr<WindowAggregatorState> GetLocalState(const WindowAggregatorState &gstate) const override;
+	void Evaluate(const WindowAggregatorState &gsink, WindowAggregatorState &lstate, const DataChunk &bounds,
+	              Vector &result, idx_t count, idx_t row_idx) const override;
+
+	//! The segment tree for the halos
+	WindowSegmentTree tree;
+	//! Context for the buffer manager
+	ClientContext &context;
+};
+
 class WindowDistinctAggregator : public WindowAggregator {
 public:
 	WindowDistinctAggregator(AggregateObject aggr, const vector<LogicalType> &arg_types_p,
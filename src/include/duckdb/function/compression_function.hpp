@@ -22,7 +22,9 @@ class ColumnData;
 class ColumnDataCheckpointer;
 class ColumnSegment;
 class SegmentStatistics;
+class TableFilter;
 struct ColumnSegmentState;
+struct SelectionVector;
 
 struct ColumnFetchState;
 struct ColumnScanState;
@@ -169,6 +171,11 @@ typedef void (*compression_fetch_row_t)(ColumnSegment &segment, ColumnFetchState
 //! Function prototype used for skipping 'skip_count' values, non-trivial if random-access is not supported for the
 //! compressed data.
 typedef void (*compression_skip_t)(ColumnSegment &segment, ColumnScanState &state, idx_t skip_count);
+//! Function prototype used for reading an entire vector (STANDARD_VECTOR_SIZE) and filtering it on the compressed data
+//! (e.g., once per run or per dictionary entry). Only the rows in 'sel' are considered, 'sel' and
+//! 'approved_tuple_count' are updated to the rows that pass the filter. If no row passes, the result can be left empty
+typedef void (*compression_filter_t)(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                                     SelectionVector &sel, idx_t &approved_tuple_count, const TableFilter &filter);
 
 //===--------------------------------------------------------------------===//
 // Append (optional)
@@ -206,13 +213,13 @@ public:
 	                    compression_serialize_state_t serialize_state = nullptr,
 	                    compression_deserialize_state_t deserialize_state = nullptr,
 	                    compression_cleanup_state_t cleanup_state = nullptr,
-	                    compression_init_prefetch_t init_prefetch = nullptr)
+	                    compression_init_prefetch_t init_prefetch = nullptr, compression_filter_t filter = nullptr)
 	    : type(type), data_type(data_type), init_analyze(init_analyze), analyze(analyze), final_analyze(final_analyze),
 	      init_compression(init_compression), compress(compress), compress_finalize(compress_finalize),
 	      init_prefetch(init_prefetch), init_scan(init_scan), scan_vector(scan_vector), scan_partial(scan_partial),
 	      fetch_row(fetch_row), skip(skip), init_segment(init_segment), init_append(init_append), append(append),
 	      finalize_append(finalize_append), revert_append(revert_append), serialize_state(serialize_state),
-	      deserialize_state(deserialize_state), cleanup_state(cleanup_state) {
+	      deserialize_state(deserialize_state), cleanup_state(cleanup_state), filter(filter) {
 	}
 
 	//! Compression type
@@ -280,6 +287,13 @@ public:
 	compression_deserialize_state_t deserialize_state;
 	//! Cleanup the segment state (optional)
 	compression_cleanup_state_t cleanup_state;
+
+	// Filter functions
+	//! This avoids decompressing (or comparing) every value when the scan has a filter on the column
+
+	//! Scan an entire vector and filter it on the compressed data (optional)
+	//! The filter is only used for filters that reject NULL values - the validity is applied by the caller
+	compression_filter_t filter;
 };
 
 //! The set of compression functions
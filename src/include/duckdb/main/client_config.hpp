@@ -91,6 +91,9 @@ struct ClientConfig {
 	//! Maximum bits allowed for using a perfect hash table (i.e. the perfect HT can hold up to 2^perfect_ht_threshold
 	//! elements)
 	idx_t perfect_ht_threshold = 12;
+	//! The factor by which the estimated size of the groups of an aggregate has to exceed the memory limit before a
+	//! sort-based aggregate is used instead of a hash aggregate (0 = never)
+	double sort_aggregate_memory_ratio = 10.0;
 	//! The maximum number of rows to accumulate before sorting ordered aggregates.
 	idx_t ordered_aggregate_threshold = (idx_t(1) << 18);
 	//! The number of rows to accumulate before flushing during a partitioned write
@@ -101,6 +104,8 @@ struct ClientConfig {
 	idx_t nested_loop_join_threshold = 5;
 	//! The number of rows we need on either table to choose a merge join over an IE join
 	idx_t merge_join_threshold = 1000;
+	//! The share of the threads that queries of this connection get relative to queries of other connections
+	idx_t scheduler_weight = 100;
 
 	//! The maximum amount of memory to keep buffered in a streaming query result. Default: 1mb.
 	idx_t streaming_buffer_size = 1000000;
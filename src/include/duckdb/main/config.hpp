@@ -61,6 +61,8 @@ enum class CheckpointAbort : uint8_t {
 	DEBUG_ABORT_AFTER_FREE_LIST_WRITE = 3
 };
 
+enum class ThreadPinMode : uint8_t { OFF = 0, ON = 1, AUTO = 2 };
+
 typedef void (*set_global_function_t)(DatabaseInstance *db, DBConfig &config, const Value &parameter);
 typedef void (*set_local_function_t)(ClientContext &context, const Value &parameter);
 typedef void (*reset_global_function_t)(DatabaseInstance *db, DBConfig &config);
@@ -124,7 +126,15 @@ struct DBConfigOptions {
 	AccessMode access_mode = AccessMode::AUTOMATIC;
 	//! Checkpoint when WAL reaches this size (default: 16MB)
 	idx_t checkpoint_wal_size = 1 << 24;
-	//! Whether or not to use Direct IO, bypassing operating system buffers
+	//! Whether automatic checkpoints are performed by a background thread instead of by the committing transaction
+	bool background_checkpoint = false;
+	//! Whether concurrent commits share a single sync of the WAL (group commit)
+	bool wal_group_commit = false;
+	//! With group commit: how long (in microseconds) a commit waits for other commits before syncing the WAL
+	idx_t wal_group_commit_delay = 0;
+	//! The amount of row groups that table scans read ahead in the background (0 = no read-ahead)
+	idx_t scan_prefetch_row_groups = 0;
+	//! Whether or not to use Direct IO for database and temporary files, bypassing operating system buffers
 	bool use_direct_io = false;
 	//! Whether extensions should be loaded on start-up
 	bool load_extensions = true;
@@ -197,6 +207,8 @@ struct DBConfigOptions {
 	set<OptimizerType> disabled_optimizers;
 	//! Force a specific compression method to be used when checkpointing (if available)
 	CompressionType force_compression = CompressionType::COMPRESSION_AUTO;
+	//! The fraction of the vectors of a column that are analyzed by every compression method at checkpoint (1 = all)
+	double compression_analyze_sample = 1.0;
 	//! Force a specific bitpacking mode to be used when using the bitpacking compression method
 	BitpackingMode force_bitpacking_mode = BitpackingMode::AUTO;
 	//! Debug setting for window aggregation mode: (window, combine, separate)
@@ -248,6 +260,18 @@ struct DBConfigOptions {
 	idx_t allocator_bulk_deallocation_flush_threshold = 536870912ULL;
 	//! Whether the allocator background thread is enabled
 	bool allocator_background_threads = false;
+	//! Whether to pin the threads of the task scheduler to CPUs (AUTO: only on machines with many cores)
+	//! This is off by default, as all database instances in a process would pin their threads to the same cores
+	ThreadPinMode pin_threads = ThreadPinMode::OFF;
+	//! Whether the threads are shared between concurrent queries based on their scheduler_weight, instead of executing
+	//! the tasks in the order in which they were scheduled
+	bool fair_scheduling = false;
+	//! The maximum time (in ms) that a new query waits for memory used by other queries to be freed (0: no waiting)
+	idx_t admission_timeout = 0;
+	//! The maximum amount of plans in the database-wide plan cache (0: plans are not cached)
+	idx_t plan_cache_size = 0;
+	//! The maximum memory of the results in the database-wide result cache (0: results are not cached)
+	idx_t result_cache_memory_limit = 0;
 	//! DuckDB API surface
 	string duckdb_api;
 	//! Metadata from DuckDB callers
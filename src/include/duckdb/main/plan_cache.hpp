@@ -0,0 +1,73 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/plan_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/case_insensitive_map.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/common/vector.hpp"
+#include "duckdb/planner/expression/bound_parameter_data.hpp"
+
+namespace duckdb {
+class ClientContext;
+class PhysicalOperator;
+class PreparedStatementData;
+class SQLStatement;
+
+//! The PlanCache holds the physical plans of recently executed statements for all connections of a database, so that
+//! repeated statements can skip the planner and optimizer.
+//! Plans are keyed by the normalized SQL, the parameter types, and the settings of the connection. A plan is only used
+//! if all catalogs that it reads from still have the version that the plan was bound against, and no changes were
+//! committed to the tables that it reads from since it was planned.
+//! As a physical plan holds the state of its execution, a plan is taken out of the cache while it is being executed
+class PlanCache {
+public:
+	//! Get the PlanCache of the database of the client
+	DUCKDB_API static PlanCache &Get(ClientContext &context);
+	//! Whether plan caching is enabled for the client (i.e., plan_cache_size is set, and no verification is enabled)
+	static bool IsEnabled(ClientContext &context);
+
+	//! Returns the key of the statement, or an empty string if the statement cannot be cached
+	string GetKey(ClientContext &context, SQLStatement &statement,
+	              optional_ptr<case_insensitive_map_t<BoundParameterData>> parameters);
+	//! Takes a plan for the key out of the cache, returns nullptr if there is no plan or the plan has to be re-bound
+	shared_ptr<PreparedStatementData> Take(ClientContext &context, const string &key,
+	                                       optional_ptr<case_insensitive_map_t<BoundParameterData>> parameters);
+	//! Puts a plan back into the cache after it has been executed, the least recently used plans are evicted
+	void Put(ClientContext &context, const string &key, shared_ptr<PreparedStatementData> prepared);
+	//! Removes all plans from the cache (e.g., after a global setting was changed)
+	DUCKDB_API void Clear();
+	//! The amount of plans in the cache
+	DUCKDB_API idx_t Count();
+
+private:
+	//! Whether no changes were made to the tables that the plan reads from since it was optimized - the optimizer uses
+	//! the statistics of the tables (e.g., to remove filters that never match), which are only valid for the data that
+	//! existed at that time
+	static bool IsUpToDate(ClientContext &context, const PreparedStatementData &prepared);
+	//! Whether the plan only reads from tables, i.e., binding it again would give the same plan as long as the catalog
+	//! is unchanged (table functions can read external data, e.g., files that might have been changed)
+	static bool IsCacheable(const PhysicalOperator &op);
+
+private:
+	struct CachedPlan {
+		string key;
+		shared_ptr<PreparedStatementData> prepared;
+	};
+
+	mutex lock;
+	//! The cached plans, the most recently used plan first
+	list<CachedPlan> plans;
+	//! The cached plans by key - a statement can have multiple plans, if it is being executed by multiple connections
+	unordered_map<string, vector<list<CachedPlan>::iterator>> plan_map;
+};
+
+} // namespace duckdb
@@ -21,6 +21,7 @@ class CatalogEntry;
 class ClientContext;
 class PhysicalOperator;
 class SQLStatement;
+struct DataTableInfo;
 
 class PreparedStatementData {
 public:
@@ -40,6 +41,9 @@ public:
 
 	//! The statement properties
 	StatementProperties properties;
+	//! The tables that the statement reads from (before the optimizer removed any scans), with the commit id of the
+	//! last change to them when the statement was planned
+	vector<pair<shared_ptr<DataTableInfo>, transaction_t>> tables;
 
 	//! The map of parameter index to the actual value entry
 	bound_parameter_map_t value_map;
@@ -58,4 +62,8 @@ public:
 	DUCKDB_API bool TryGetType(const string &identifier, LogicalType &result);
 };
 
+//! Whether the catalog still has the identity (i.e., the same version) that a statement was bound against
+bool CheckCatalogIdentity(ClientContext &context, const string &catalog_name,
+                          const StatementProperties::CatalogIdentity catalog_identity);
+
 } // namespace duckdb
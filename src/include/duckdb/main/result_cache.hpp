@@ -0,0 +1,94 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/result_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/case_insensitive_map.hpp"
+#include "duckdb/common/enums/statement_type.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/common/vector.hpp"
+#include "duckdb/planner/expression/bound_parameter_data.hpp"
+
+namespace duckdb {
+class ClientContext;
+class ColumnDataCollection;
+class LogicalOperator;
+class PreparedStatementData;
+class SQLStatement;
+struct DataTableInfo;
+
+//! A query result in the ResultCache
+struct CachedResult {
+	//! The result
+	unique_ptr<ColumnDataCollection> collection;
+	//! The properties, names and types of the statement
+	StatementProperties properties;
+	vector<string> names;
+	vector<LogicalType> types;
+	//! The tables that the result was computed from, with the commit id of the last change to them that it includes
+	vector<pair<shared_ptr<DataTableInfo>, transaction_t>> tables;
+	//! The amount of memory used by the result
+	idx_t size;
+
+public:
+	//! Creates a prepared statement that scans the result (the result must be kept alive while it is executed)
+	shared_ptr<PreparedStatementData> CreatePreparedStatement();
+};
+
+//! The ResultCache holds the results of recently executed SELECT statements for all connections of a database, so that
+//! a statement that is executed again can scan its result instead of running the query.
+//! A result is only used if no transaction committed changes to the tables that it was computed from since, and if the
+//! catalogs that it reads from still have the same version. The results are stored in ColumnDataCollections that are
+//! allocated through the buffer manager, and take up to 'result_cache_memory_limit' memory
+class ResultCache {
+public:
+	//! Get the ResultCache of the database of the client
+	DUCKDB_API static ResultCache &Get(ClientContext &context);
+	//! Whether result caching is enabled for the client (i.e., it is not in an explicit transaction)
+	static bool IsEnabled(ClientContext &context);
+	//! Whether the results of a logical plan can be cached, i.e., the plan only reads from tables and does not have any
+	//! volatile (e.g., random()) or time-dependent (e.g., now()) expressions
+	static bool IsConsistent(LogicalOperator &op);
+
+	//! Returns the key of the statement, or an empty string if its result cannot be cached
+	string GetKey(ClientContext &context, SQLStatement &statement,
+	              optional_ptr<case_insensitive_map_t<BoundParameterData>> parameters);
+	//! Returns the result for the key if it is up-to-date for the transaction of the client, or nullptr otherwise
+	shared_ptr<CachedResult> Get(ClientContext &context, const string &key);
+	//! Stores the result of a statement that was executed by the (still active) transaction of the client
+	void Put(ClientContext &context, const string &key, PreparedStatementData &prepared, ColumnDataCollection &result);
+	//! Removes all results from the cache
+	DUCKDB_API void Clear();
+	//! The amount of results in the cache
+	DUCKDB_API idx_t Count();
+
+private:
+	//! Whether the result is up-to-date for the transaction of the client
+	static bool IsValid(ClientContext &context, const CachedResult &result);
+	//! Collects the tables that the statement reads from, returns false if the result might not include the last
+	//! change to one of them
+	static bool GetTables(ClientContext &context, const PreparedStatementData &prepared,
+	                      vector<pair<shared_ptr<DataTableInfo>, transaction_t>> &tables);
+	//! Removes a result from the cache (must hold the lock)
+	void RemoveResult(list<pair<string, shared_ptr<CachedResult>>>::iterator entry,
+	                  vector<shared_ptr<CachedResult>> &removed_results);
+
+private:
+	mutex lock;
+	//! The cached results, the most recently used result first
+	list<pair<string, shared_ptr<CachedResult>>> results;
+	//! The cached results by key
+	unordered_map<string, list<pair<string, shared_ptr<CachedResult>>>::iterator> result_map;
+	//! The amount of memory used by the cached results
+	idx_t memory_usage = 0;
+};
+
+} // namespace duckdb
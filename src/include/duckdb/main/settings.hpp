@@ -91,6 +91,57 @@ struct CheckpointThresholdSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct BackgroundCheckpointSetting {
+	static constexpr const char *Name = "background_checkpoint";
+	static constexpr const char *Description =
+	    "Whether automatic checkpoints are performed by a background thread instead of by the committing transaction";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct WALGroupCommitSetting {
+	static constexpr const char *Name = "wal_group_commit";
+	static constexpr const char *Description =
+	    "Whether concurrent commits are synced to disk together, instead of syncing the WAL for every commit";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct WALGroupCommitDelaySetting {
+	static constexpr const char *Name = "wal_group_commit_delay";
+	static constexpr const char *Description =
+	    "With wal_group_commit: the time (in microseconds) a commit waits for other commits before syncing the WAL";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct ScanPrefetchRowGroupsSetting {
+	static constexpr const char *Name = "scan_prefetch_row_groups";
+	static constexpr const char *Description =
+	    "The amount of row groups that table scans read ahead on background threads (0 disables the read-ahead)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct UseDirectIOSetting {
+	static constexpr const char *Name = "use_direct_io";
+	static constexpr const char *Description =
+	    "Whether database files and temporary files are read and written with Direct IO, bypassing the page cache of "
+	    "the operating system. Only affects files that are opened after the setting is changed.";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct DebugCheckpointAbort {
 	static constexpr const char *Name = "debug_checkpoint_abort";
 	static constexpr const char *Description =
@@ -460,6 +511,16 @@ struct FileSearchPathSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct CompressionAnalyzeSampleSetting {
+	static constexpr const char *Name = "compression_analyze_sample";
+	static constexpr const char *Description =
+	    "The fraction of the vectors of a column that are analyzed by every compression method when checkpointing";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::DOUBLE;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct ForceCompressionSetting {
 	static constexpr const char *Name = "force_compression";
 	static constexpr const char *Description = "DEBUG SETTING: forces a specific compression method to be used";
@@ -722,6 +783,17 @@ struct PerfectHashThresholdSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct SortAggregateMemoryRatioSetting {
+	static constexpr const char *Name = "sort_aggregate_memory_ratio";
+	static constexpr const char *Description =
+	    "Use a sort-based aggregate when the estimated size of the groups exceeds the memory limit by this factor (0 "
+	    "disables the sort-based aggregate)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::DOUBLE;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct PivotFilterThreshold {
 	static constexpr const char *Name = "pivot_filter_threshold";
 	static constexpr const char *Description =
@@ -917,6 +989,71 @@ struct AllocatorBackgroundThreadsSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct PinThreadsSetting {
+	static constexpr const char *Name = "pin_threads";
+	static constexpr const char *Description =
+	    "Whether to pin threads to cores (Linux only, default OFF, AUTO: on when there are more than 64 cores)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct FairSchedulingSetting {
+	static constexpr const char *Name = "fair_scheduling";
+	static constexpr const char *Description =
+	    "Whether the threads are shared between concurrent queries based on the scheduler_weight of their connection";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct SchedulerWeightSetting {
+	static constexpr const char *Name = "scheduler_weight";
+	static constexpr const char *Description =
+	    "The share of the threads that the queries of this connection get when other queries run concurrently "
+	    "and fair_scheduling is enabled (between 1 and 10000, default 100)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct AdmissionTimeoutSetting {
+	static constexpr const char *Name = "admission_timeout";
+	static constexpr const char *Description =
+	    "The maximum time (in ms) that a new query waits for memory while other queries need more memory than "
+	    "available, before it starts anyway (0 disables this)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct PlanCacheSizeSetting {
+	static constexpr const char *Name = "plan_cache_size";
+	static constexpr const char *Description =
+	    "The maximum amount of query plans that are cached, so that repeated SELECT statements of all connections can "
+	    "skip planning and optimization (0 disables the plan cache)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct ResultCacheMemoryLimitSetting {
+	static constexpr const char *Name = "result_cache_memory_limit";
+	static constexpr const char *Description =
+	    "The maximum memory of the query results that are cached, so that repeated SELECT statements of all "
+	    "connections can return the result without running the query if the tables they read from are unchanged (0 "
+	    "disables the result cache)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct DuckDBApiSetting {
 	static constexpr const char *Name = "duckdb_api";
 	static constexpr const char *Description = "DuckDB API surface";
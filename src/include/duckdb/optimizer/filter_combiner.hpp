@@ -10,6 +10,7 @@
 
 #include "duckdb/common/types/value.hpp"
 #include "duckdb/common/unordered_map.hpp"
+#include "duckdb/common/unordered_set.hpp"
 #include "duckdb/parser/expression_map.hpp"
 #include "duckdb/planner/expression.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
@@ -47,7 +48,10 @@ public:
 
 	void GenerateFilters(const std::function<void(unique_ptr<Expression> filter)> &callback);
 	bool HasFilters();
-	TableFilterSet GenerateTableScanFilters(const vector<idx_t> &column_ids);
+	//! Generates the filters that are pushed into a table scan - IN lists that cannot become a range are only pushed
+	//! as an IN filter into the columns of "in_filter_columns" (e.g. columns that have a bloom filter)
+	TableFilterSet GenerateTableScanFilters(const vector<idx_t> &column_ids,
+	                                        const unordered_set<idx_t> &in_filter_columns = unordered_set<idx_t>());
 	// vector<unique_ptr<TableFilter>> GenerateZonemapChecks(vector<idx_t> &column_ids, vector<unique_ptr<TableFilter>>
 	// &pushed_filters);
 
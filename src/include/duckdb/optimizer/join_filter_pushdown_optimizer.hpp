@@ -12,6 +12,7 @@
 #include "duckdb/planner/column_binding_map.hpp"
 
 namespace duckdb {
+class LogicalGet;
 class Optimizer;
 
 //! The JoinFilterPushdownOptimizer links comparison joins to data sources to enable dynamic execution-time filter
@@ -24,6 +25,10 @@ public:
 
 private:
 	void GenerateJoinFilters(LogicalComparisonJoin &join);
+	//! Finds the LogicalGet that produces the column "binding" (which is updated to the binding in the LogicalGet)
+	//! "crosses_pipelines" is set if the LogicalGet is in a different pipeline than "probe_child"
+	static optional_ptr<LogicalGet> FindProbeSource(LogicalOperator &probe_child, ColumnBinding &binding,
+	                                                bool &crosses_pipelines);
 
 private:
 	Optimizer &optimizer;
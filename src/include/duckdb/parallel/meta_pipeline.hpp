@@ -66,7 +66,9 @@ public:
 	//! where 'including' determines whether 'start' is added to the dependencies
 	vector<shared_ptr<Pipeline>> AddDependenciesFrom(Pipeline &dependant, const Pipeline &start, bool including);
 	//! Recursively makes all children of this MetaPipeline depend on the given Pipeline
-	void AddRecursiveDependencies(const vector<shared_ptr<Pipeline>> &new_dependencies, const MetaPipeline &last_child);
+	//! If "only_large_pipelines" is set, dependencies are only added between pipelines that can keep all threads busy
+	void AddRecursiveDependencies(const vector<shared_ptr<Pipeline>> &new_dependencies, const MetaPipeline &last_child,
+	                              bool only_large_pipelines = true);
 	//! Make sure that the given pipeline has its own PipelineFinishEvent (e.g., for IEJoin - double Finalize)
 	void AddFinishEvent(Pipeline &pipeline);
 	//! Whether the pipeline needs its own PipelineFinishEvent
@@ -31,12 +31,28 @@ struct ProducerToken {
 	TaskScheduler &scheduler;
 	unique_ptr<QueueProducerToken> token;
 	mutex producer_lock;
+	//! The share of the background threads that this producer gets relative to the other producers (set by the
+	//! 'scheduler_weight' setting of the connection that owns this producer)
+	atomic<idx_t> weight;
+	//! The weighted amount of tasks that the background threads have taken from this producer
+	atomic<idx_t> virtual_time;
+	//! The amount of tasks of this producer that are in the queue
+	atomic<idx_t> queued_tasks;
 };
 
 //! The TaskScheduler is responsible for managing tasks and threads
 class TaskScheduler {
+	friend struct ProducerToken;
+
 	// timeout for semaphore wait, default 5ms
 	constexpr static int64_t TASK_TIMEOUT_USECS = 5000;
+	// with ThreadPinMode::AUTO, threads are pinned if there are more than this many cores
+	constexpr static idx_t THREAD_PIN_THRESHOLD = 64;
+
+public:
+	// the default (and maximum) weight of a producer
+	constexpr static idx_t DEFAULT_PRODUCER_WEIGHT = 100;
+	constexpr static idx_t MAXIMUM_PRODUCER_WEIGHT = 10000;
 
 public:
 	explicit TaskScheduler(DatabaseInstance &db);
@@ -45,7 +61,7 @@ public:
 	DUCKDB_API static TaskScheduler &GetScheduler(ClientContext &context);
 	DUCKDB_API static TaskScheduler &GetScheduler(DatabaseInstance &db);
 
-	unique_ptr<ProducerToken> CreateProducer();
+	unique_ptr<ProducerToken> CreateProducer(idx_t weight = DEFAULT_PRODUCER_WEIGHT);
 	//! Schedule a task to be executed by the task scheduler
 	void ScheduleTask(ProducerToken &producer, shared_ptr<Task> task);
 	//! Fetches a task from a specific producer, returns true if successful or false if no tasks were available
@@ -67,6 +83,9 @@ public:
 
 	//! Returns the number of threads
 	DUCKDB_API int32_t NumberOfThreads();
+	//! Returns the number of background worker threads, i.e., the threads that execute tasks without a client waiting
+	//! for them (the number of threads minus the number of external threads)
+	DUCKDB_API idx_t NumberOfBackgroundThreads();
 
 	//! Send signals to n threads, signalling for them to wake up and attempt to execute a task
 	void Signal(idx_t n);
@@ -86,11 +105,23 @@ public:
 
 private:
 	void RelaunchThreadsInternal(int32_t n);
+	//! Removes a producer that is about to be destroyed (called by the destructor of ProducerToken)
+	void RemoveProducer(ProducerToken &token);
+	//! Fetches a task for a background thread. With fair_scheduling, the task is taken from the producer that has the
+	//! lowest virtual time, i.e., that received the smallest share of the threads relative to its weight (weighted
+	//! fair queueing). Otherwise, the tasks are taken in the order in which they were scheduled
+	bool DequeueTask(shared_ptr<Task> &task);
+	//! Pins the background threads to cores, or lets them run on any core, depending on the pin_threads setting
+	void SetThreadAffinity();
 
 private:
 	DatabaseInstance &db;
 	//! The task queue
 	unique_ptr<ConcurrentQueue> queue;
+	//! Lock for the producers
+	mutex producer_lock;
+	//! The producers that are currently alive
+	vector<reference<ProducerToken>> producers;
 	//! Lock for modifying the thread count
 	mutex thread_lock;
 	//! The active background threads of the task scheduler
@@ -105,6 +136,8 @@ private:
 	atomic<int32_t> requested_thread_count;
 	//! The amount of threads currently running
 	atomic<int32_t> current_thread_count;
+	//! The amount of background worker threads currently running
+	atomic<idx_t> background_thread_count;
 };
 
 } // namespace duckdb
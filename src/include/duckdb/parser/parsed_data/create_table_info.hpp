@@ -32,6 +32,8 @@ struct CreateTableInfo : public CreateInfo {
 	vector<unique_ptr<Constraint>> constraints;
 	//! CREATE TABLE as QUERY
 	unique_ptr<SelectStatement> query;
+	//! The columns by which the data of the table is sorted when it is checkpointed (if any)
+	vector<string> sort_keys;
 
 public:
 	DUCKDB_API unique_ptr<CreateInfo> Copy() const override;
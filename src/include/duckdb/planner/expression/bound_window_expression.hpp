@@ -72,6 +72,8 @@ public:
 
 	bool PartitionsAreEquivalent(const BoundWindowExpression &other) const;
 	bool KeysAreCompatible(const BoundWindowExpression &other) const;
+	//! Whether the functions have compatible keys and the same frame specification
+	bool FramesAreEquivalent(const BoundWindowExpression &other) const;
 	bool Equals(const BaseExpression &other) const override;
 
 	unique_ptr<Expression> Copy() const override;
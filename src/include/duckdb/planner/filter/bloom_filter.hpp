@@ -0,0 +1,41 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/types/bloom_filter.hpp"
+
+namespace duckdb {
+
+//! BloomTableFilter filters out the rows whose hash is not contained in a bloom filter, e.g., the join keys of a hash
+//! join build side. It can have false positives, so it may only be used where the filter is re-checked later on
+class BloomTableFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::BLOOM_FILTER;
+
+public:
+	BloomTableFilter(LogicalType key_type, shared_ptr<BloomFilter> bloom_filter);
+
+	//! The type of the keys that were hashed into the bloom filter
+	LogicalType key_type;
+	//! The bloom filter (shared between copies of this filter, it is not modified after it has been pushed)
+	shared_ptr<BloomFilter> bloom_filter;
+
+public:
+	//! Filters "sel" down to the rows of "input" that can pass the filter
+	idx_t Filter(Vector &input, idx_t count, SelectionVector &sel, idx_t &approved_tuple_count) const;
+
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	unique_ptr<Expression> ToExpression(const Expression &column) const override;
+};
+
+} // namespace duckdb
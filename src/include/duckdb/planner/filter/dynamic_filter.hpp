@@ -0,0 +1,59 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/dynamic_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/common/mutex.hpp"
+
+namespace duckdb {
+
+//! The (shared) state of a dynamic filter, which can be tightened by the operator that produced it while it is used
+//! A constant filter is never modified once it is set - tightening the filter replaces it, so readers can take a
+//! reference to the current filter and evaluate it without holding the lock
+struct DynamicFilterData {
+	explicit DynamicFilterData(ExpressionType comparison_type);
+
+	//! Held while the filter is replaced or its reference is copied
+	mutex lock;
+	//! The comparison of the filter (e.g. COMPARE_GREATERTHANOREQUALTO)
+	ExpressionType comparison_type;
+	//! The current filter - nullptr while no value has been set yet, in which case every row passes
+	shared_ptr<const ConstantFilter> filter;
+
+public:
+	//! Returns the current filter (or nullptr) - the lock must NOT be held
+	shared_ptr<const ConstantFilter> GetFilter();
+	//! Sets the constant of the filter - the lock must be held
+	void SetValue(Value val);
+	//! Removes the filter again - the lock must be held
+	void Reset();
+};
+
+//! DynamicFilter is a comparison against a constant that can change while the filter is evaluated, e.g., the current
+//! boundary value of a top-n. It is only ever produced at execution time.
+class DynamicFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::DYNAMIC_FILTER;
+
+public:
+	explicit DynamicFilter(shared_ptr<DynamicFilterData> filter_data);
+
+	//! The filter data (shared between copies of this filter)
+	shared_ptr<DynamicFilterData> filter_data;
+
+public:
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	unique_ptr<Expression> ToExpression(const Expression &column) const override;
+};
+
+} // namespace duckdb
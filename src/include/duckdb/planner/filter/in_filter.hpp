@@ -0,0 +1,47 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/in_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+namespace duckdb {
+
+//! InFilter checks if a column is equal to any of a (small) set of constants, e.g., the keys of a hash join build side
+class InFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::IN_FILTER;
+
+public:
+	explicit InFilter(vector<Value> values);
+
+	//! The (non-NULL) values to filter on, these must all have the same type
+	vector<Value> values;
+
+public:
+	//! Filters "sel" down to the rows of "input" (which has "count" rows) that are equal to one of the values
+	idx_t Filter(Vector &input, idx_t count, SelectionVector &sel, idx_t &approved_tuple_count) const;
+
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	unique_ptr<Expression> ToExpression(const Expression &column) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+
+private:
+	//! The values as a vector, so they can be compared to the input
+	unique_ptr<Vector> values_vector;
+	//! The hashes of the values along with their index, sorted by hash
+	vector<pair<hash_t, idx_t>> value_hashes;
+};
+
+} // namespace duckdb
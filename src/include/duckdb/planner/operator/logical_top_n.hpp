@@ -10,6 +10,7 @@
 
 #include "duckdb/planner/bound_query_node.hpp"
 #include "duckdb/planner/logical_operator.hpp"
+#include "duckdb/planner/table_filter.hpp"
 
 namespace duckdb {
 
@@ -28,6 +29,10 @@ public:
 	idx_t limit;
 	//! The offset from the start to begin emitting elements
 	idx_t offset;
+	//! The dynamic filters of the scan that the boundary value of the first ordering column is pushed into (if any)
+	shared_ptr<DynamicTableFilterSet> dynamic_filters;
+	//! The column index of the scan that the boundary value is pushed into
+	idx_t dynamic_filter_column = DConstants::INVALID_INDEX;
 
 public:
 	vector<ColumnBinding> GetColumnBindings() override {
@@ -28,7 +28,10 @@ enum class TableFilterType : uint8_t {
 	IS_NOT_NULL = 2,
 	CONJUNCTION_OR = 3,
 	CONJUNCTION_AND = 4,
-	STRUCT_EXTRACT = 5
+	STRUCT_EXTRACT = 5,
+	BLOOM_FILTER = 6,  // bloom filter over a set of (hashed) values, only ever produced at execution time
+	IN_FILTER = 7,     // column IN (C1, C2, ...)
+	DYNAMIC_FILTER = 8 // comparison with a constant that can change, only ever produced at execution time
 };
 
 //! TableFilter represents a filter pushed down into the table scan.
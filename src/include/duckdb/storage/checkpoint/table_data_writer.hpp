@@ -30,6 +30,8 @@ public:
 	void WriteTableData(Serializer &metadata_serializer);
 
 	CompressionType GetColumnCompressionType(idx_t i);
+	//! Returns the physical columns by which the data of the table is sorted
+	vector<PhysicalIndex> GetSortColumns();
 
 	virtual void FinalizeTable(const TableStatistics &global_stats, DataTableInfo *info, Serializer &serializer) = 0;
 	virtual unique_ptr<RowGroupWriter> GetRowGroupWriter(RowGroup &row_group) = 0;
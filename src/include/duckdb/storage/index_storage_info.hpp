@@ -65,6 +65,11 @@ struct IndexStorageInfo {
 	bool IsValid() const {
 		return root_block_ptr.IsValid() || !allocator_infos.empty();
 	}
+	//! Returns true, if IndexStorageInfo holds information to deserialize an index, or to restore an index that does
+	//! not hold any data (e.g., BLOOM indexes) from its options.
+	bool HasInfo() const {
+		return IsValid() || !options.empty();
+	}
 
 	void Serialize(Serializer &serializer) const;
 	static IndexStorageInfo Deserialize(Deserializer &deserializer);
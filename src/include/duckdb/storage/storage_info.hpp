@@ -14,6 +14,7 @@
 #include "duckdb/common/vector_size.hpp"
 
 namespace duckdb {
+class FileBuffer;
 struct FileHandle;
 
 //! The standard row group size
@@ -76,7 +77,8 @@ struct MainHeader {
 	uint64_t version_number;
 	//! The set of flags used by the database
 	uint64_t flags[FLAG_COUNT];
-	static void CheckMagicBytes(FileHandle &handle);
+	//! Checks the magic bytes of the file, reading the first sector of the file into the (sector-aligned) buffer
+	static void CheckMagicBytes(FileHandle &handle, FileBuffer &buffer);
 
 	string LibraryGitDesc() {
 		return string(char_ptr_cast(library_git_desc), 0, MAX_VERSION_SIZE);
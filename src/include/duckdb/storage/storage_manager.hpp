@@ -36,6 +36,13 @@ public:
 	virtual void RevertCommit() = 0;
 	// Make the commit persistent
 	virtual void FlushCommit() = 0;
+	//! Whether FlushCommit has deferred syncing the commit to disk, in which case SyncCommit must be called
+	virtual bool RequiresSync() {
+		return false;
+	}
+	//! Wait until the commit has been synced to disk
+	virtual void SyncCommit() {
+	}
 
 	virtual void AddRowGroupData(DataTable &table, idx_t start_index, idx_t count,
 	                             unique_ptr<PersistentCollectionData> row_group_data) = 0;
@@ -95,6 +102,10 @@ public:
 	//! The path to the WAL, derived from the database file path
 	string GetWALPath();
 	bool InMemory();
+	//! Request the next checkpoint to be performed, even if there is nothing in the WAL to flush
+	void RequestCheckpoint() {
+		checkpoint_requested = true;
+	}
 
 	virtual bool AutomaticCheckpoint(idx_t estimated_wal_bytes) = 0;
 	virtual unique_ptr<StorageCommitState> GenStorageCommitState(WriteAheadLog &wal) = 0;
@@ -120,6 +131,8 @@ protected:
 	//! When loading a database, we do not yet set the wal-field. Therefore, GetWriteAheadLog must
 	//! return nullptr when loading a database
 	bool load_complete = false;
+	//! Whether the next checkpoint has been requested to be performed regardless of the contents of the WAL
+	atomic<bool> checkpoint_requested;
 
 public:
 	template <class TARGET>
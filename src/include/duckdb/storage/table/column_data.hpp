@@ -20,6 +20,7 @@
 #include "duckdb/common/serializer/serialization_traits.hpp"
 
 namespace duckdb {
+class BloomFilter;
 class ColumnData;
 class ColumnSegment;
 class DatabaseInstance;
@@ -110,6 +111,9 @@ public:
 	//! Select
 	virtual void Select(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result,
 	                    SelectionVector &sel, idx_t &count, const TableFilter &filter);
+	//! Scans only the selected rows of a base vector (of "target_count" rows) from the column, without any updates
+	void ScanVectorSelection(ColumnScanState &state, Vector &result, idx_t target_count, const SelectionVector &sel,
+	                         idx_t sel_count);
 	virtual void FilterScan(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result,
 	                        SelectionVector &sel, idx_t count);
 	virtual void FilterScanCommitted(idx_t vector_index, ColumnScanState &state, Vector &result, SelectionVector &sel,
@@ -174,12 +178,28 @@ public:
 	void MergeIntoStatistics(BaseStatistics &other);
 	unique_ptr<BaseStatistics> GetStatistics();
 
+	//! Returns the bloom filter over the values of the column, if it has one
+	shared_ptr<BloomFilter> GetBloomFilter() const;
+	//! Builds the bloom filter over the committed values of the column, unless it has an up-to-date one already
+	void InitializeBloomFilter();
+	//! Drops the bloom filter of the column, this must happen whenever values are added to or changed in the column
+	void ClearBloomFilter();
+
 protected:
 	//! Append a transient segment
 	void AppendTransientSegment(SegmentLock &l, idx_t start_row);
 
+	//! Prepares the scan state for scanning the next vector from the current segment
+	void BeginScanVector(ColumnScanState &state);
+	//! Moves the scan state forward to the row, and to the segment that contains it
+	void MoveScanToRow(ColumnScanState &state, idx_t row_index, bool include_end);
 	//! Scans a base vector from the column
 	idx_t ScanVector(ColumnScanState &state, Vector &result, idx_t remaining, ScanVectorType scan_type);
+	//! Whether the next vector can be filtered on the compressed data of the current segment
+	bool CanFilterVector(ColumnScanState &state, idx_t scan_count, Vector &result, const TableFilter &filter);
+	//! Scans a base vector from the current segment, and filters it on the compressed data
+	void FilterVector(ColumnScanState &state, idx_t scan_count, Vector &result, SelectionVector &sel,
+	                  idx_t &approved_tuple_count, const TableFilter &filter);
 	//! Scans a vector from the column merged with any potential updates
 	//! If ALLOW_UPDATES is set to false, the function will instead throw an exception if any updates are found
 	template <bool SCAN_COMMITTED, bool ALLOW_UPDATES>
@@ -206,6 +226,8 @@ protected:
 	mutable mutex stats_lock;
 	//! The stats of the root segment
 	unique_ptr<SegmentStatistics> stats;
+	//! The bloom filter over the values of the column (if any), built at checkpoint for columns with a BLOOM index
+	shared_ptr<BloomFilter> bloom_filter;
 	//! Total transient allocation size
 	idx_t allocation_size;
 };
@@ -224,6 +246,8 @@ struct PersistentColumnData {
 	PhysicalType physical_type;
 	vector<DataPointer> pointers;
 	vector<PersistentColumnData> child_columns;
+	//! The bloom filter over the values of the column, if it has a BLOOM index
+	shared_ptr<BloomFilter> bloom_filter;
 	bool has_updates = false;
 
 	void Serialize(Serializer &serializer) const;
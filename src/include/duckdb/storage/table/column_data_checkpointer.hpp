@@ -33,6 +33,10 @@ public:
 private:
 	void ScanSegments(const std::function<void(Vector &, idx_t)> &callback);
 	unique_ptr<AnalyzeState> DetectBestCompressionMethod(idx_t &compression_idx);
+	//! Runs the analyze step of the remaining compression methods on every sample_step'th vector, and returns the
+	//! state of the method with the best score
+	unique_ptr<AnalyzeState> AnalyzeCompressionMethods(CompressionType forced_method, idx_t sample_step,
+	                                                   idx_t &compression_idx);
 	void WriteToDisk();
 	bool HasChanges();
 	void WritePersistentSegments();
@@ -69,6 +69,11 @@ public:
 	void InitializeScan(ColumnScanState &state);
 	//! Scan one vector from this segment
 	void Scan(ColumnScanState &state, idx_t scan_count, Vector &result, idx_t result_offset, ScanVectorType scan_type);
+	//! Whether the filter can be evaluated on the compressed data of this segment (see CompressionFunction::filter)
+	bool CanFilter(const TableFilter &filter) const;
+	//! Scan an entire vector from this segment, and filter it on the compressed data
+	void Filter(ColumnScanState &state, idx_t scan_count, Vector &result, SelectionVector &sel,
+	            idx_t &approved_tuple_count, const TableFilter &filter);
 	//! Fetch a value of the specific row id and append it to the result
 	void FetchRow(ColumnFetchState &state, row_t row_id, Vector &result, idx_t result_idx);
 
@@ -52,6 +52,23 @@ public:
 	string GetTableName();
 	void SetTableName(string name);
 
+	//! The commit id of the last transaction that committed changes to the data of the table (0 if there were none
+	//! since the table was loaded)
+	transaction_t GetLastCommitId() const {
+		return last_commit_id;
+	}
+	void SetLastCommitId(transaction_t commit_id) {
+		last_commit_id = commit_id;
+	}
+
+	//! Whether the next checkpoint should re-sort all row groups of the table by its sort key (requested by VACUUM)
+	bool IsReorderRequested() const {
+		return reorder_requested;
+	}
+	void SetReorderRequested(bool requested) {
+		reorder_requested = requested;
+	}
+
 private:
 	//! The database instance of the table
 	AttachedDatabase &db;
@@ -69,6 +86,10 @@ private:
 	vector<IndexStorageInfo> index_storage_infos;
 	//! Lock held while checkpointing
 	StorageLock checkpoint_lock;
+	//! The commit id of the last transaction that committed changes to the data of the table
+	atomic<transaction_t> last_commit_id;
+	//! Whether the next checkpoint should re-sort all row groups of the table
+	atomic<bool> reorder_requested;
 };
 
 } // namespace duckdb
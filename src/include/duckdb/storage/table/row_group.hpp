@@ -40,6 +40,7 @@ struct PersistentRowGroupData;
 struct RowGroupPointer;
 struct TransactionData;
 class CollectionScanState;
+struct PrefetchState;
 class TableFilterSet;
 struct ColumnFetchState;
 struct RowGroupAppendState;
@@ -113,6 +114,8 @@ public:
 	//! Checks the given set of table filters against the per-segment statistics. Returns false if any segments were
 	//! skipped.
 	bool CheckZonemapSegments(CollectionScanState &state);
+	//! Adds the on-disk blocks that a scan with the given state reads from this row group to the prefetch state
+	void InitializePrefetch(CollectionScanState &state, PrefetchState &prefetch_state);
 	void Scan(TransactionData transaction, CollectionScanState &state, DataChunk &result);
 	void ScanCommitted(CollectionScanState &state, DataChunk &result, TableScanType type);
 
@@ -142,9 +145,20 @@ public:
 	//! Returns the number of committed rows (count - committed deletes)
 	idx_t GetCommittedRowCount();
 	RowGroupWriteData WriteToDisk(RowGroupWriter &writer);
+	//! Prepares the row group for being written by the given writer, and returns the compression types of its columns
+	vector<CompressionType> InitializeWriteToDisk(RowGroupWriter &writer);
+	//! Writes a single column of the row group to disk - the columns of a row group can be written concurrently
+	unique_ptr<ColumnCheckpointState> WriteColumnToDisk(RowGroupWriteInfo &info, idx_t column_idx);
 	RowGroupPointer Checkpoint(RowGroupWriteData write_data, RowGroupWriter &writer, TableStatistics &global_stats);
 	bool IsPersistent() const;
 	PersistentRowGroupData SerializeRowGroupInfo() const;
+	//! Whether or not the row group was written by a checkpoint, and no rows have been appended to it since
+	bool IsCheckpointed() const {
+		return checkpointed;
+	}
+	void SetCheckpointed() {
+		checkpointed = true;
+	}
 
 	void InitializeAppend(RowGroupAppendState &append_state);
 	void Append(RowGroupAppendState &append_state, DataChunk &chunk, idx_t append_count);
@@ -202,6 +216,7 @@ private:
 	vector<MetaBlockPointer> deletes_pointers;
 	atomic<bool> deletes_is_loaded;
 	idx_t allocation_size;
+	bool checkpointed;
 };
 
 } // namespace duckdb
@@ -0,0 +1,43 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/table/row_group_prefetcher.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+
+namespace duckdb {
+class BlockHandle;
+class BufferManager;
+class TaskScheduler;
+struct ProducerToken;
+struct RowGroupPrefetchState;
+
+//! The RowGroupPrefetcher reads the blocks of row groups that a scan will reach soon on the background threads of the
+//! task scheduler, so that the I/O of upcoming row groups overlaps with the scan of the current ones
+class RowGroupPrefetcher {
+public:
+	RowGroupPrefetcher(BufferManager &buffer_manager, TaskScheduler &scheduler, idx_t row_group_count);
+	~RowGroupPrefetcher();
+
+	//! The amount of row groups the scan reads ahead
+	const idx_t row_group_count;
+
+public:
+	//! Schedule a background read of the given blocks
+	void Prefetch(vector<shared_ptr<BlockHandle>> blocks);
+	//! Cancel all reads that have not started yet, and wait for the running reads to finish
+	void Stop();
+
+private:
+	TaskScheduler &scheduler;
+	shared_ptr<RowGroupPrefetchState> state;
+	unique_ptr<ProducerToken> token;
+};
+
+} // namespace duckdb
@@ -24,6 +24,7 @@ class CollectionScanState;
 class Index;
 class RowGroup;
 class RowGroupCollection;
+class RowGroupPrefetcher;
 class UpdateSegment;
 class TableScanState;
 class ColumnSegment;
@@ -109,6 +110,9 @@ struct ColumnFetchState {
 	buffer_handle_set_t handles;
 	//! Any child states of the fetch
 	vector<unique_ptr<ColumnFetchState>> child_states;
+	//! The states of segments that are kept between fetches (e.g., the last decompressed frame of a ZSTD segment),
+	//! by the block id and offset of the segment
+	map<pair<block_id_t, idx_t>, unique_ptr<SegmentScanState>> segment_states;
 
 	BufferHandle &GetOrInsertHandle(ColumnSegment &segment);
 };
@@ -245,6 +249,10 @@ private:
 
 struct ParallelCollectionScanState {
 	ParallelCollectionScanState();
+	~ParallelCollectionScanState();
+
+	//! Near the end of a parallel scan, row groups are split up into morsels of at least this many vectors
+	static constexpr const idx_t MIN_MORSEL_VECTOR_COUNT = 8;
 
 	//! The row group collection we are scanning
 	RowGroupCollection *collection;
@@ -254,15 +262,20 @@ struct ParallelCollectionScanState {
 	idx_t batch_index;
 	atomic<idx_t> processed_rows;
 	mutex lock;
+	//! Reads the blocks of upcoming row groups in the background (if enabled)
+	unique_ptr<RowGroupPrefetcher> prefetcher;
+	//! The last row group that has been handed to the prefetcher
+	RowGroup *prefetch_row_group;
 };
 
 struct ParallelTableScanState {
+	//! Shared lock over the checkpoint to prevent checkpoints while reading
+	//! Declared first so that it is released only after the prefetches of the scan states have been stopped
+	shared_ptr<CheckpointLock> checkpoint_lock;
 	//! Parallel scan state for the table
 	ParallelCollectionScanState scan_state;
 	//! Parallel scan state for the transaction-local state
 	ParallelCollectionScanState local_state;
-	//! Shared lock over the checkpoint to prevent checkpoints while reading
-	shared_ptr<CheckpointLock> checkpoint_lock;
 };
 
 struct PrefetchState {
@@ -15,6 +15,10 @@ namespace duckdb {
 
 //! Standard column data represents a regular flat column (e.g. a column of type INTEGER or STRING)
 class StandardColumnData : public ColumnData {
+public:
+	//! Only the selected rows of a vector are scanned if at most 1/LATE_MATERIALIZATION_RATIO of its rows are selected
+	static constexpr const idx_t LATE_MATERIALIZATION_RATIO = 8;
+
 public:
 	StandardColumnData(BlockManager &block_manager, DataTableInfo &info, idx_t column_index, idx_t start_row,
 	                   LogicalType type, optional_ptr<ColumnData> parent = nullptr);
@@ -35,6 +39,10 @@ public:
 	idx_t ScanCommitted(idx_t vector_index, ColumnScanState &state, Vector &result, bool allow_updates,
 	                    idx_t target_count) override;
 	idx_t ScanCount(ColumnScanState &state, Vector &result, idx_t count) override;
+	void Select(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result,
+	            SelectionVector &sel, idx_t &count, const TableFilter &filter) override;
+	void FilterScan(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result,
+	                SelectionVector &sel, idx_t count) override;
 
 	void InitializeAppend(ColumnAppendState &state) override;
 	void AppendData(BaseStatistics &stats, ColumnAppendState &state, UnifiedVectorFormat &vdata, idx_t count) override;
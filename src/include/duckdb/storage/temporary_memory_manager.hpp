@@ -10,9 +10,12 @@
 
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/common/mutex.hpp"
+#include "duckdb/common/optional_ptr.hpp"
 #include "duckdb/common/reference_map.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
 class ClientContext;
@@ -24,7 +27,8 @@ class TemporaryMemoryState {
 	friend class TemporaryMemoryManager;
 
 private:
-	TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager, idx_t minimum_reservation);
+	TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager, ClientContext &context,
+	                     idx_t minimum_reservation);
 
 public:
 	~TemporaryMemoryState();
@@ -54,6 +58,8 @@ public:
 private:
 	//! The TemporaryMemoryManager that owns this state
 	TemporaryMemoryManager &temporary_memory_manager;
+	//! The client that registered this state (only used to tell apart the states of different clients)
+	optional_ptr<ClientContext> context;
 
 	//! The remaining size needed if it could fit fully in memory
 	atomic<idx_t> remaining_size;
@@ -94,6 +100,10 @@ public:
 	static TemporaryMemoryManager &Get(ClientContext &context);
 	//! Register a TemporaryMemoryState
 	unique_ptr<TemporaryMemoryState> Register(ClientContext &context);
+	//! Admission control: blocks a new query of this client while the states of other clients need more memory than
+	//! the limit, so that the query waits for memory to be freed rather than making everyone spill to disk.
+	//! Waits at most 'admission_timeout' milliseconds (0 disables admission control)
+	void WaitForAdmission(ClientContext &context);
 
 private:
 	//! Locks the TemporaryMemoryManager
@@ -112,10 +122,14 @@ private:
 	idx_t ComputeReservation(const TemporaryMemoryState &temporary_memory_state) const;
 	//! Verify internal counts (must hold the lock)
 	void Verify() const;
+	//! Whether the states of other clients than "context" need more memory than the limit (must hold the lock)
+	bool HasMemoryPressure(ClientContext &context) const;
 
 private:
 	//! Lock because TemporaryMemoryManager is used concurrently
 	mutex lock;
+	//! Notified when the remaining size of a state decreases, wakes up queries that wait for admission
+	std::condition_variable admission_cv;
 
 	//! Memory limit of the buffer pool
 	idx_t memory_limit = DConstants::INVALID_INDEX;
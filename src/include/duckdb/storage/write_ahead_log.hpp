@@ -20,6 +20,8 @@
 #include "duckdb/storage/block.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
 struct AlterInfo;
@@ -113,6 +115,12 @@ public:
 	//! Delete the WAL file on disk. The WAL should not be used after this point.
 	void Delete();
 	void Flush();
+	//! Writes a flush entry and hands the WAL to the file system without syncing it (group commit)
+	//! Returns the number of the flush, the flush is durable once SyncFlush has been called for it
+	idx_t FlushWithoutSync();
+	//! Waits until the given flush (and all flushes before it) has been synced to disk - one of the waiting threads
+	//! syncs the WAL on behalf of all of them, after waiting for up to max_wait microseconds for other commits
+	void SyncFlush(idx_t flush_id, idx_t max_wait);
 
 	void WriteCheckpoint(MetaBlockPointer meta_block);
 
@@ -123,6 +131,16 @@ protected:
 	string wal_path;
 	atomic<idx_t> wal_size;
 	atomic<bool> initialized;
+
+	//! The amount of flushes that have been handed to the file system by FlushWithoutSync
+	atomic<idx_t> written_flushes;
+	//! Lock for the group commit state
+	mutex sync_lock;
+	std::condition_variable sync_cv;
+	//! The amount of flushes that are known to be synced to disk
+	idx_t synced_flushes;
+	//! Whether a thread is currently syncing the WAL
+	bool syncing;
 };
 
 } // namespace duckdb
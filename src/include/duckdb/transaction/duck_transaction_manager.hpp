@@ -14,6 +14,8 @@
 
 namespace duckdb {
 class DuckTransaction;
+struct BackgroundCheckpointState;
+struct ProducerToken;
 
 //! The Transaction Manager is responsible for creating and managing
 //! transactions
@@ -33,6 +35,10 @@ public:
 	void RollbackTransaction(Transaction &transaction) override;
 
 	void Checkpoint(ClientContext &context, bool force = false) override;
+	//! Checkpoints the database from a background thread - skipped if a write transaction is active
+	void BackgroundCheckpoint();
+	//! Stops scheduling background checkpoints, and waits for a running background checkpoint to finish
+	void StopBackgroundCheckpoints();
 
 	transaction_t LowestActiveId() const {
 		return lowest_active_id;
@@ -67,6 +73,8 @@ protected:
 		bool can_checkpoint;
 		string reason;
 		CheckpointType type;
+		//! Whether the checkpoint should be performed by a background thread after the commit has finished
+		bool schedule_background = false;
 	};
 
 private:
@@ -80,6 +88,8 @@ private:
 	//! Whether or not we can checkpoint
 	CheckpointDecision CanCheckpoint(DuckTransaction &transaction, unique_ptr<StorageLockKey> &checkpoint_lock,
 	                                 const UndoBufferProperties &properties);
+	//! Schedules a background checkpoint, unless one is already scheduled (the transaction lock must be held)
+	void ScheduleBackgroundCheckpoint();
 
 private:
 	//! The current start timestamp used by transactions
@@ -107,6 +117,11 @@ private:
 	//! Mutex used to control writes to the WAL - separate from the transaction lock
 	mutex wal_lock;
 
+	//! The state shared with the scheduled background checkpoint tasks
+	shared_ptr<BackgroundCheckpointState> background_checkpoint;
+	//! The producer token used to schedule background checkpoints (created on first use)
+	unique_ptr<ProducerToken> background_checkpoint_token;
+
 	atomic<idx_t> last_uncommitted_catalog_version = {TRANSACTION_ID_START};
 	idx_t last_committed_version = 0;
 
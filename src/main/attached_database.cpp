@@ -216,6 +216,11 @@ void AttachedDatabase::Close() {
 	}
 	is_closed = true;
 
+	if (transaction_manager && transaction_manager->IsDuckTransactionManager()) {
+		// background checkpoints must be finished before the final checkpoint and before the scheduler is destroyed
+		DuckTransactionManager::Get(*this).StopBackgroundCheckpoints();
+	}
+
 	if (!IsSystem() && !catalog->InMemory()) {
 		db.GetDatabaseManager().EraseDatabasePath(catalog->GetDBPath());
 	}
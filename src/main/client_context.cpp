@@ -20,6 +20,8 @@
 #include "duckdb/main/database_manager.hpp"
 #include "duckdb/main/error_manager.hpp"
 #include "duckdb/main/materialized_query_result.hpp"
+#include "duckdb/main/plan_cache.hpp"
+#include "duckdb/main/result_cache.hpp"
 #include "duckdb/main/query_profiler.hpp"
 #include "duckdb/main/query_result.hpp"
 #include "duckdb/main/relation.hpp"
@@ -37,6 +39,7 @@
 #include "duckdb/parser/statement/relation_statement.hpp"
 #include "duckdb/parser/statement/select_statement.hpp"
 #include "duckdb/planner/operator/logical_execute.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/planner/planner.hpp"
 #include "duckdb/planner/pragma_handler.hpp"
 #include "duckdb/storage/data_table.hpp"
@@ -49,12 +52,18 @@ struct ActiveQueryContext {
 public:
 	//! The query that is currently being executed
 	string query;
+	//! The cached result that the query scans (if any) - it is kept alive until the query has finished
+	shared_ptr<CachedResult> cached_result;
 	//! Prepared statement data
 	shared_ptr<PreparedStatementData> prepared;
 	//! The query executor
 	unique_ptr<Executor> executor;
 	//! The progress bar
 	unique_ptr<ProgressBar> progress_bar;
+	//! The key under which the plan is put into the plan cache when the query ends (if any)
+	string plan_cache_key;
+	//! The key under which the result is put into the result cache when it has been fetched (if any)
+	string result_cache_key;
 
 public:
 	void SetOpenResult(BaseQueryResult &result) {
@@ -211,6 +220,11 @@ ErrorData ClientContext::EndQueryInternal(ClientContextLock &lock, bool success,
 	active_query->progress_bar.reset();
 
 	D_ASSERT(active_query.get());
+	if (success && !active_query->plan_cache_key.empty() && active_query->prepared) {
+		// the executor refers to the plan, so it has to be destroyed before another client can take the plan
+		active_query->executor.reset();
+		PlanCache::Get(*this).Put(*this, active_query->plan_cache_key, std::move(active_query->prepared));
+	}
 	active_query.reset();
 	query_progress.Initialize();
 	ErrorData error;
@@ -299,6 +313,12 @@ unique_ptr<QueryResult> ClientContext::FetchResultInternal(ClientContextLock &lo
 	// we have a result collector - fetch the result directly from the result collector
 	result = executor.GetResult();
 	if (!create_stream_result) {
+		if (!active_query->result_cache_key.empty() && !result->HasError() &&
+		    result->type == QueryResultType::MATERIALIZED_RESULT) {
+			// the transaction has to be active to determine which changes the result includes
+			auto &collection = result->Cast<MaterializedQueryResult>().Collection();
+			ResultCache::Get(*this).Put(*this, active_query->result_cache_key, prepared, collection);
+		}
 		CleanupInternal(lock, result.get(), false);
 	} else {
 		active_query->SetOpenResult(*result);
@@ -306,6 +326,23 @@ unique_ptr<QueryResult> ClientContext::FetchResultInternal(ClientContextLock &lo
 	return result;
 }
 
+//! Collects the tables that a logical plan scans - this has to happen before optimizing the plan, as the optimizer can
+//! remove scans (e.g., if the statistics of the table show that a filter never matches), and the plan can only include
+//! the changes to the tables up to the commit ids that are collected here
+static void GetScannedTables(LogicalOperator &op, vector<pair<shared_ptr<DataTableInfo>, transaction_t>> &tables) {
+	if (op.type == LogicalOperatorType::LOGICAL_GET) {
+		auto table = op.Cast<LogicalGet>().GetTable();
+		if (table && table->IsDuckTable()) {
+			auto info = table->GetStorage().GetDataTableInfo();
+			auto last_commit_id = info->GetLastCommitId();
+			tables.emplace_back(std::move(info), last_commit_id);
+		}
+	}
+	for (auto &child : op.children) {
+		GetScannedTables(*child, tables);
+	}
+}
+
 static bool IsExplainAnalyze(SQLStatement *statement) {
 	if (!statement) {
 		return false;
@@ -348,6 +385,12 @@ ClientContext::CreatePreparedStatementInternal(ClientContextLock &lock, const st
 	if (!planner.properties.bound_all_parameters) {
 		return result;
 	}
+	if (ResultCache::IsEnabled(*this)) {
+		result->properties.is_consistent = ResultCache::IsConsistent(*plan);
+	}
+	if (result->properties.is_consistent || PlanCache::IsEnabled(*this)) {
+		GetScannedTables(*plan, result->tables);
+	}
 #ifdef DEBUG
 	plan->Verify(*this);
 #endif
@@ -734,9 +777,41 @@ unique_ptr<QueryResult> ClientContext::Execute(const string &query, shared_ptr<P
 unique_ptr<PendingQueryResult> ClientContext::PendingStatementInternal(ClientContextLock &lock, const string &query,
                                                                        unique_ptr<SQLStatement> statement,
                                                                        const PendingQueryParameters &parameters) {
-	// prepare the query for execution
-	auto prepared = CreatePreparedStatement(lock, query, std::move(statement), parameters.parameters,
-	                                        PreparedStatementMode::PREPARE_AND_EXECUTE);
+	// repeated statements can skip execution entirely if their result is in the result cache
+	string result_cache_key;
+	if (ResultCache::IsEnabled(*this)) {
+		auto &result_cache = ResultCache::Get(*this);
+		result_cache_key = result_cache.GetKey(*this, *statement, parameters.parameters);
+		auto cached_result = result_cache_key.empty() ? nullptr : result_cache.Get(*this, result_cache_key);
+		if (cached_result) {
+			auto pending = PendingPreparedStatementInternal(lock, cached_result->CreatePreparedStatement(), parameters);
+			active_query->cached_result = std::move(cached_result);
+			return pending;
+		}
+	}
+	// repeated statements can skip the planner and optimizer by taking their plan from the plan cache
+	shared_ptr<PreparedStatementData> prepared;
+	string plan_cache_key;
+	if (PlanCache::IsEnabled(*this)) {
+		auto &plan_cache = PlanCache::Get(*this);
+		plan_cache_key = plan_cache.GetKey(*this, *statement, parameters.parameters);
+		if (!plan_cache_key.empty()) {
+			prepared = plan_cache.Take(*this, plan_cache_key, parameters.parameters);
+		}
+	}
+	if (!prepared) {
+		// prepare the query for execution
+		unique_ptr<SQLStatement> unbound_statement;
+		if (!plan_cache_key.empty()) {
+			// the plan cache needs the unbound statement to check if the plan has to be re-bound
+			unbound_statement = statement->Copy();
+		}
+		prepared = CreatePreparedStatement(lock, query, std::move(statement), parameters.parameters,
+		                                   PreparedStatementMode::PREPARE_AND_EXECUTE);
+		if (!prepared->unbound_statement) {
+			prepared->unbound_statement = std::move(unbound_statement);
+		}
+	}
 	idx_t parameter_count = !parameters.parameters ? 0 : parameters.parameters->size();
 	if (prepared->properties.parameter_count > 0 && parameter_count == 0) {
 		string error_message = StringUtil::Format("Expected %lld parameters, but none were supplied",
@@ -748,7 +823,10 @@ unique_ptr<PendingQueryResult> ClientContext::PendingStatementInternal(ClientCon
 	}
 	// execute the prepared statement
 	CheckIfPreparedStatementIsExecutable(*prepared);
-	return PendingPreparedStatementInternal(lock, std::move(prepared), parameters);
+	auto pending = PendingPreparedStatementInternal(lock, std::move(prepared), parameters);
+	active_query->plan_cache_key = std::move(plan_cache_key);
+	active_query->result_cache_key = std::move(result_cache_key);
+	return pending;
 }
 
 unique_ptr<QueryResult> ClientContext::RunStatementInternal(ClientContextLock &lock, const string &query,
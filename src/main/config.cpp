@@ -61,6 +61,11 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(AllowPersistentSecrets),
     DUCKDB_GLOBAL(CatalogErrorMaxSchema),
     DUCKDB_GLOBAL(CheckpointThresholdSetting),
+    DUCKDB_GLOBAL(BackgroundCheckpointSetting),
+    DUCKDB_GLOBAL(WALGroupCommitSetting),
+    DUCKDB_GLOBAL(WALGroupCommitDelaySetting),
+    DUCKDB_GLOBAL(ScanPrefetchRowGroupsSetting),
+    DUCKDB_GLOBAL(UseDirectIOSetting),
     DUCKDB_GLOBAL(DebugCheckpointAbort),
     DUCKDB_GLOBAL(DebugSkipCheckpointOnCommit),
     DUCKDB_GLOBAL(StorageCompatibilityVersion),
@@ -94,6 +99,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(ExtensionDirectorySetting),
     DUCKDB_GLOBAL(ExternalThreadsSetting),
     DUCKDB_LOCAL(FileSearchPathSetting),
+    DUCKDB_GLOBAL(CompressionAnalyzeSampleSetting),
     DUCKDB_GLOBAL(ForceCompressionSetting),
     DUCKDB_GLOBAL(ForceBitpackingModeSetting),
     DUCKDB_LOCAL(HomeDirectorySetting),
@@ -121,6 +127,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_LOCAL(OrderedAggregateThreshold),
     DUCKDB_GLOBAL(PasswordSetting),
     DUCKDB_LOCAL(PerfectHashThresholdSetting),
+    DUCKDB_LOCAL(SortAggregateMemoryRatioSetting),
     DUCKDB_LOCAL(PivotFilterThreshold),
     DUCKDB_LOCAL(PivotLimitSetting),
     DUCKDB_LOCAL(PreserveIdentifierCase),
@@ -148,6 +155,12 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(AllocatorFlushThreshold),
     DUCKDB_GLOBAL(AllocatorBulkDeallocationFlushThreshold),
     DUCKDB_GLOBAL(AllocatorBackgroundThreadsSetting),
+    DUCKDB_GLOBAL(PinThreadsSetting),
+    DUCKDB_GLOBAL(FairSchedulingSetting),
+    DUCKDB_LOCAL(SchedulerWeightSetting),
+    DUCKDB_GLOBAL(AdmissionTimeoutSetting),
+    DUCKDB_GLOBAL(PlanCacheSizeSetting),
+    DUCKDB_GLOBAL(ResultCacheMemoryLimitSetting),
     DUCKDB_GLOBAL(DuckDBApiSetting),
     DUCKDB_GLOBAL(CustomUserAgentSetting),
     DUCKDB_LOCAL(PartitionedWriteFlushThreshold),
@@ -15,6 +15,8 @@
 #include "duckdb/main/db_instance_cache.hpp"
 #include "duckdb/main/error_manager.hpp"
 #include "duckdb/main/extension_helper.hpp"
+#include "duckdb/main/plan_cache.hpp"
+#include "duckdb/main/result_cache.hpp"
 #include "duckdb/main/secret/secret_manager.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parsed_data/attach_info.hpp"
@@ -59,6 +61,9 @@ DatabaseInstance::DatabaseInstance() {
 }
 
 DatabaseInstance::~DatabaseInstance() {
+	// cached plans and results refer to the catalog entries and tables of the attached databases
+	plan_cache.reset();
+	result_cache.reset();
 	// destroy all attached databases
 	GetDatabaseManager().ResetDatabases(scheduler);
 	// destroy child elements
@@ -281,6 +286,8 @@ void DatabaseInstance::Initialize(const char *database_path, DBConfig *user_conf
 	}
 	scheduler = make_uniq<TaskScheduler>(*this);
 	object_cache = make_uniq<ObjectCache>();
+	plan_cache = make_uniq<PlanCache>();
+	result_cache = make_uniq<ResultCache>();
 	connection_manager = make_uniq<ConnectionManager>();
 
 	// initialize the secret manager
@@ -360,6 +367,14 @@ ObjectCache &DatabaseInstance::GetObjectCache() {
 	return *object_cache;
 }
 
+PlanCache &DatabaseInstance::GetPlanCache() {
+	return *plan_cache;
+}
+
+ResultCache &DatabaseInstance::GetResultCache() {
+	return *result_cache;
+}
+
 FileSystem &DatabaseInstance::GetFileSystem() {
 	return *db_file_system;
 }
@@ -7,6 +7,8 @@
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/database_path_and_type.hpp"
 #include "duckdb/main/extension_helper.hpp"
+#include "duckdb/main/plan_cache.hpp"
+#include "duckdb/main/result_cache.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 
 namespace duckdb {
@@ -74,7 +76,11 @@ void DatabaseManager::DetachDatabase(ClientContext &context, const string &name,
 		if (if_not_found == OnEntryNotFound::THROW_EXCEPTION) {
 			throw BinderException("Failed to detach database with name \"%s\": database not found", name);
 		}
+		return;
 	}
+	// cached plans and results can refer to the catalog entries and tables of the detached database
+	PlanCache::Get(context).Clear();
+	ResultCache::Get(context).Clear();
 }
 
 optional_ptr<AttachedDatabase> DatabaseManager::GetDatabaseFromPath(ClientContext &context, const string &path) {
@@ -0,0 +1,202 @@
+#include "duckdb/main/plan_cache.hpp"
+
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
+#include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/client_context_state.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/main/prepared_statement_data.hpp"
+#include "duckdb/parser/sql_statement.hpp"
+#include "duckdb/storage/table/data_table_info.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/transaction/local_storage.hpp"
+
+namespace duckdb {
+
+PlanCache &PlanCache::Get(ClientContext &context) {
+	return DatabaseInstance::GetDatabase(context).GetPlanCache();
+}
+
+bool PlanCache::IsEnabled(ClientContext &context) {
+	if (DBConfig::GetConfig(context).options.plan_cache_size == 0) {
+		return false;
+	}
+	if (ClientConfig::GetConfig(context).AnyVerification()) {
+		// verification compares the results of (re-)planned statements
+		return false;
+	}
+	for (auto &state : context.registered_state->States()) {
+		if (state->CanRequestRebind()) {
+			// the plan might depend on the state of an extension
+			return false;
+		}
+	}
+	return true;
+}
+
+static void AppendValues(string &key, const case_insensitive_map_t<Value> &values) {
+	vector<string> entries;
+	for (auto &entry : values) {
+		entries.push_back(entry.first + "=" + entry.second.ToString());
+	}
+	std::sort(entries.begin(), entries.end());
+	for (auto &entry : entries) {
+		key += "\n" + entry;
+	}
+}
+
+string PlanCache::GetKey(ClientContext &context, SQLStatement &statement,
+                         optional_ptr<case_insensitive_map_t<BoundParameterData>> parameters) {
+	if (statement.type != StatementType::SELECT_STATEMENT) {
+		return string();
+	}
+	string key;
+	try {
+		// the normalized SQL, so that statements only differing in whitespace or case share their plan
+		key = statement.ToString();
+	} catch (std::exception &ex) {
+		return string();
+	}
+	if (parameters) {
+		vector<string> parameter_types;
+		for (auto &parameter : *parameters) {
+			parameter_types.push_back(parameter.first + " " + parameter.second.GetValue().type().ToString());
+		}
+		std::sort(parameter_types.begin(), parameter_types.end());
+		for (auto &parameter_type : parameter_types) {
+			key += "\n$" + parameter_type;
+		}
+	}
+	// the settings of the connection can change the plan (e.g., the search path, or disabled optimizers)
+	// global settings are not part of the key, the cache is cleared when they are changed instead
+	auto &config = ClientConfig::GetConfig(context);
+	for (idx_t option_idx = 0; option_idx < DBConfig::GetOptionCount(); option_idx++) {
+		auto option = DBConfig::GetOptionByIndex(option_idx);
+		if (!option->set_local || !option->get_setting) {
+			continue;
+		}
+		key += "\n";
+		key += option->name;
+		key += "=" + option->get_setting(context).ToString();
+	}
+	key += config.enable_optimizer ? "\noptimizer" : "\nno_optimizer";
+	AppendValues(key, config.set_variables);
+	AppendValues(key, config.user_variables);
+	return key;
+}
+
+shared_ptr<PreparedStatementData>
+PlanCache::Take(ClientContext &context, const string &key,
+                optional_ptr<case_insensitive_map_t<BoundParameterData>> parameters) {
+	while (true) {
+		shared_ptr<PreparedStatementData> prepared;
+		{
+			lock_guard<mutex> guard(lock);
+			auto entry = plan_map.find(key);
+			if (entry == plan_map.end()) {
+				return nullptr;
+			}
+			auto plan = entry->second.back();
+			entry->second.pop_back();
+			if (entry->second.empty()) {
+				plan_map.erase(entry);
+			}
+			prepared = std::move(plan->prepared);
+			plans.erase(plan);
+		}
+		// check if the catalogs that the plan was bound against, or the data it was optimized for have changed since
+		bool require_rebind;
+		try {
+			require_rebind = prepared->RequireRebind(context, parameters) || !IsUpToDate(context, *prepared);
+		} catch (std::exception &ex) {
+			// e.g., a database that the plan reads from was detached
+			require_rebind = true;
+		}
+		if (!require_rebind) {
+			return prepared;
+		}
+		// the plan is outdated: drop it, and try the next plan for this key (if any)
+	}
+}
+
+bool PlanCache::IsUpToDate(ClientContext &context, const PreparedStatementData &prepared) {
+	for (auto &entry : prepared.tables) {
+		auto &info = *entry.first;
+		if (info.GetLastCommitId() != entry.second) {
+			// changes were committed to the table since
+			return false;
+		}
+		auto &transaction = DuckTransaction::Get(context, info.GetDB());
+		if (transaction.GetLocalStorage().ChangesMade()) {
+			// the transaction has appended rows that are not included in the statistics the plan was optimized with
+			return false;
+		}
+	}
+	return true;
+}
+
+bool PlanCache::IsCacheable(const PhysicalOperator &op) {
+	if (op.type == PhysicalOperatorType::TABLE_SCAN) {
+		auto &scan = op.Cast<PhysicalTableScan>();
+		if (scan.function.name != "seq_scan" && scan.function.name != "index_scan") {
+			return false;
+		}
+	}
+	for (auto &child : op.GetChildren()) {
+		if (!IsCacheable(child.get())) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//! Releases the states that the last execution left behind in the operators, as they can refer to the client
+static void ResetOperatorStates(PhysicalOperator &op) {
+	op.op_state.reset();
+	op.sink_state.reset();
+	for (auto &child : op.GetChildren()) {
+		// GetChildren only gives const references, but the plan is owned by the cache
+		ResetOperatorStates(const_cast<PhysicalOperator &>(child.get())); // NOLINT
+	}
+}
+
+void PlanCache::Put(ClientContext &context, const string &key, shared_ptr<PreparedStatementData> prepared) {
+	const auto cache_size = DBConfig::GetConfig(context).options.plan_cache_size;
+	if (cache_size == 0 || !prepared->plan || !prepared->unbound_statement || !IsCacheable(*prepared->plan)) {
+		return;
+	}
+	ResetOperatorStates(*prepared->plan);
+
+	// evicted plans are destroyed after releasing the lock
+	vector<shared_ptr<PreparedStatementData>> evicted_plans;
+	lock_guard<mutex> guard(lock);
+	plans.push_front(CachedPlan {key, std::move(prepared)});
+	plan_map[key].push_back(plans.begin());
+	while (plans.size() > cache_size) {
+		auto plan = std::prev(plans.end());
+		auto entry = plan_map.find(plan->key);
+		D_ASSERT(entry != plan_map.end());
+		auto &key_plans = entry->second;
+		key_plans.erase(std::find(key_plans.begin(), key_plans.end(), plan));
+		if (key_plans.empty()) {
+			plan_map.erase(entry);
+		}
+		evicted_plans.push_back(std::move(plan->prepared));
+		plans.erase(plan);
+	}
+}
+
+void PlanCache::Clear() {
+	list<CachedPlan> cleared_plans;
+	lock_guard<mutex> guard(lock);
+	plan_map.clear();
+	cleared_plans.swap(plans);
+}
+
+idx_t PlanCache::Count() {
+	lock_guard<mutex> guard(lock);
+	return plans.size();
+}
+
+} // namespace duckdb
@@ -0,0 +1,225 @@
+#include "duckdb/main/result_cache.hpp"
+
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/execution/operator/scan/physical_column_data_scan.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/client_context_state.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/main/plan_cache.hpp"
+#include "duckdb/main/prepared_statement_data.hpp"
+#include "duckdb/planner/logical_operator_visitor.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+
+namespace duckdb {
+
+shared_ptr<PreparedStatementData> CachedResult::CreatePreparedStatement() {
+	auto result = make_shared_ptr<PreparedStatementData>(StatementType::SELECT_STATEMENT);
+	result->properties = properties;
+	result->names = names;
+	result->types = types;
+	result->plan = make_uniq<PhysicalColumnDataScan>(types, PhysicalOperatorType::COLUMN_DATA_SCAN, collection->Count(),
+	                                                 optionally_owned_ptr<ColumnDataCollection>(*collection));
+	return result;
+}
+
+ResultCache &ResultCache::Get(ClientContext &context) {
+	return DatabaseInstance::GetDatabase(context).GetResultCache();
+}
+
+bool ResultCache::IsEnabled(ClientContext &context) {
+	if (DBConfig::GetConfig(context).options.result_cache_memory_limit == 0) {
+		return false;
+	}
+	if (!context.transaction.IsAutoCommit()) {
+		// the transaction might have changed the tables that the statement reads from
+		return false;
+	}
+	if (ClientConfig::GetConfig(context).AnyVerification()) {
+		return false;
+	}
+	for (auto &state : context.registered_state->States()) {
+		if (state->CanRequestRebind()) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool ResultCache::IsConsistent(LogicalOperator &op) {
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_GET:
+		// table functions other than table scans can read external data (e.g., files)
+		if (op.Cast<LogicalGet>().function.name != "seq_scan") {
+			return false;
+		}
+		break;
+	case LogicalOperatorType::LOGICAL_SAMPLE:
+		return false;
+	default:
+		break;
+	}
+	bool is_consistent = true;
+	LogicalOperatorVisitor::EnumerateExpressions(op, [&](unique_ptr<Expression> *expression) {
+		if (!(*expression)->IsConsistent()) {
+			is_consistent = false;
+		}
+	});
+	if (!is_consistent) {
+		return false;
+	}
+	for (auto &child : op.children) {
+		if (!IsConsistent(*child)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+string ResultCache::GetKey(ClientContext &context, SQLStatement &statement,
+                           optional_ptr<case_insensitive_map_t<BoundParameterData>> parameters) {
+	// the key of the plan, plus the values of the parameters
+	auto key = PlanCache::Get(context).GetKey(context, statement, parameters);
+	if (key.empty() || !parameters) {
+		return key;
+	}
+	vector<string> parameter_values;
+	for (auto &parameter : *parameters) {
+		parameter_values.push_back(parameter.first + "=" + parameter.second.GetValue().ToSQLString());
+	}
+	std::sort(parameter_values.begin(), parameter_values.end());
+	for (auto &parameter_value : parameter_values) {
+		key += "\n$" + parameter_value;
+	}
+	return key;
+}
+
+bool ResultCache::IsValid(ClientContext &context, const CachedResult &result) {
+	for (auto &entry : result.properties.read_databases) {
+		if (!CheckCatalogIdentity(context, entry.first, entry.second)) {
+			return false;
+		}
+	}
+	for (auto &entry : result.tables) {
+		auto &info = *entry.first;
+		auto &transaction = DuckTransaction::Get(context, info.GetDB());
+		// no changes were committed to the table since, and the transaction can see the last change
+		if (info.GetLastCommitId() != entry.second || entry.second >= transaction.start_time) {
+			return false;
+		}
+	}
+	return true;
+}
+
+shared_ptr<CachedResult> ResultCache::Get(ClientContext &context, const string &key) {
+	shared_ptr<CachedResult> result;
+	{
+		lock_guard<mutex> guard(lock);
+		auto entry = result_map.find(key);
+		if (entry == result_map.end()) {
+			return nullptr;
+		}
+		result = entry->second->second;
+		results.splice(results.begin(), results, entry->second);
+	}
+	bool is_valid;
+	try {
+		is_valid = IsValid(context, *result);
+	} catch (std::exception &ex) {
+		// e.g., a database that the result was read from was detached
+		is_valid = false;
+	}
+	if (is_valid) {
+		return result;
+	}
+	// the result is outdated: remove it (unless it was replaced in the meantime)
+	vector<shared_ptr<CachedResult>> removed_results;
+	lock_guard<mutex> guard(lock);
+	auto entry = result_map.find(key);
+	if (entry != result_map.end() && entry->second->second == result) {
+		RemoveResult(entry->second, removed_results);
+	}
+	return nullptr;
+}
+
+bool ResultCache::GetTables(ClientContext &context, const PreparedStatementData &prepared,
+                            vector<pair<shared_ptr<DataTableInfo>, transaction_t>> &tables) {
+	for (auto &entry : prepared.tables) {
+		auto &info = entry.first;
+		auto &transaction = DuckTransaction::Get(context, info->GetDB());
+		auto last_commit_id = info->GetLastCommitId();
+		if (last_commit_id >= transaction.start_time) {
+			// a change was committed after the transaction started, which is not included in the result
+			return false;
+		}
+		tables.emplace_back(info, last_commit_id);
+	}
+	return true;
+}
+
+void ResultCache::Put(ClientContext &context, const string &key, PreparedStatementData &prepared,
+                      ColumnDataCollection &result) {
+	const auto memory_limit = DBConfig::GetConfig(context).options.result_cache_memory_limit;
+	if (!prepared.properties.is_consistent || !prepared.plan || result.SizeInBytes() > memory_limit / 4) {
+		// a single result can use up to a quarter of the memory of the cache
+		return;
+	}
+	auto cached_result = make_shared_ptr<CachedResult>();
+	if (!GetTables(context, prepared, cached_result->tables)) {
+		return;
+	}
+	// copy the result, as it is handed to the client
+	auto &buffer_manager = BufferManager::GetBufferManager(context);
+	cached_result->collection = make_uniq<ColumnDataCollection>(buffer_manager, result.Types());
+	ColumnDataAppendState append_state;
+	cached_result->collection->InitializeAppend(append_state);
+	for (auto &chunk : result.Chunks()) {
+		cached_result->collection->Append(append_state, chunk);
+	}
+	cached_result->size = cached_result->collection->AllocationSize();
+	cached_result->properties = prepared.properties;
+	cached_result->names = prepared.names;
+	cached_result->types = prepared.types;
+
+	// removed results are destroyed after releasing the lock
+	vector<shared_ptr<CachedResult>> removed_results;
+	lock_guard<mutex> guard(lock);
+	auto entry = result_map.find(key);
+	if (entry != result_map.end()) {
+		RemoveResult(entry->second, removed_results);
+	}
+	memory_usage += cached_result->size;
+	results.emplace_front(key, std::move(cached_result));
+	result_map[key] = results.begin();
+	// evict the least recently used results
+	while (memory_usage > memory_limit) {
+		RemoveResult(std::prev(results.end()), removed_results);
+	}
+}
+
+void ResultCache::RemoveResult(list<pair<string, shared_ptr<CachedResult>>>::iterator entry,
+                               vector<shared_ptr<CachedResult>> &removed_results) {
+	D_ASSERT(memory_usage >= entry->second->size);
+	memory_usage -= entry->second->size;
+	result_map.erase(entry->first);
+	removed_results.push_back(std::move(entry->second));
+	results.erase(entry);
+}
+
+void ResultCache::Clear() {
+	list<pair<string, shared_ptr<CachedResult>>> cleared_results;
+	lock_guard<mutex> guard(lock);
+	result_map.clear();
+	memory_usage = 0;
+	cleared_results.swap(results);
+}
+
+idx_t ResultCache::Count() {
+	lock_guard<mutex> guard(lock);
+	return results.size();
+}
+
+} // namespace duckdb
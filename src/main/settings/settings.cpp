@@ -8,6 +8,8 @@
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/plan_cache.hpp"
+#include "duckdb/main/result_cache.hpp"
 #include "duckdb/main/query_profiler.hpp"
 #include "duckdb/main/secret/secret_manager.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
@@ -112,6 +114,90 @@ Value CheckpointThresholdSetting::GetSetting(const ClientContext &context) {
 	return Value(StringUtil::BytesToHumanReadableString(config.options.checkpoint_wal_size));
 }
 
+//===--------------------------------------------------------------------===//
+// Background Checkpoint
+//===--------------------------------------------------------------------===//
+void BackgroundCheckpointSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.background_checkpoint = BooleanValue::Get(input);
+}
+
+void BackgroundCheckpointSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.background_checkpoint = DBConfig().options.background_checkpoint;
+}
+
+Value BackgroundCheckpointSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.background_checkpoint);
+}
+
+//===--------------------------------------------------------------------===//
+// WAL Group Commit
+//===--------------------------------------------------------------------===//
+void WALGroupCommitSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.wal_group_commit = BooleanValue::Get(input);
+}
+
+void WALGroupCommitSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.wal_group_commit = DBConfig().options.wal_group_commit;
+}
+
+Value WALGroupCommitSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.wal_group_commit);
+}
+
+//===--------------------------------------------------------------------===//
+// WAL Group Commit Delay
+//===--------------------------------------------------------------------===//
+void WALGroupCommitDelaySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto delay = input.GetValue<uint64_t>();
+	if (delay > 1000000) {
+		throw InvalidInputException("wal_group_commit_delay can be at most 1000000 microseconds (1 second)");
+	}
+	config.options.wal_group_commit_delay = delay;
+}
+
+void WALGroupCommitDelaySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.wal_group_commit_delay = DBConfig().options.wal_group_commit_delay;
+}
+
+Value WALGroupCommitDelaySetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.wal_group_commit_delay);
+}
+
+//===--------------------------------------------------------------------===//
+// Scan Prefetch Row Groups
+//===--------------------------------------------------------------------===//
+void ScanPrefetchRowGroupsSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.scan_prefetch_row_groups = input.GetValue<uint64_t>();
+}
+
+void ScanPrefetchRowGroupsSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.scan_prefetch_row_groups = DBConfig().options.scan_prefetch_row_groups;
+}
+
+Value ScanPrefetchRowGroupsSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.scan_prefetch_row_groups);
+}
+
+//===--------------------------------------------------------------------===//
+// Use Direct IO
+//===--------------------------------------------------------------------===//
+void UseDirectIOSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.use_direct_io = input.GetValue<bool>();
+}
+
+void UseDirectIOSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.use_direct_io = DBConfig().options.use_direct_io;
+}
+
+Value UseDirectIOSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.use_direct_io);
+}
+
 //===--------------------------------------------------------------------===//
 // Debug Checkpoint Abort
 //===--------------------------------------------------------------------===//
@@ -1034,6 +1120,26 @@ Value FileSearchPathSetting::GetSetting(const ClientContext &context) {
 	return Value(client_data.file_search_path);
 }
 
+//===--------------------------------------------------------------------===//
+// Compression Analyze Sample
+//===--------------------------------------------------------------------===//
+void CompressionAnalyzeSampleSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto sample = input.GetValue<double>();
+	if (sample <= 0 || sample > 1.0) {
+		throw InvalidInputException("the compression analyze sample must be within (0, 1]");
+	}
+	config.options.compression_analyze_sample = sample;
+}
+
+void CompressionAnalyzeSampleSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.compression_analyze_sample = DBConfig().options.compression_analyze_sample;
+}
+
+Value CompressionAnalyzeSampleSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::DOUBLE(config.options.compression_analyze_sample);
+}
+
 //===--------------------------------------------------------------------===//
 // Force Compression
 //===--------------------------------------------------------------------===//
@@ -1546,6 +1652,25 @@ Value PerfectHashThresholdSetting::GetSetting(const ClientContext &context) {
 	return Value::BIGINT(NumericCast<int64_t>(ClientConfig::GetConfig(context).perfect_ht_threshold));
 }
 
+//===--------------------------------------------------------------------===//
+// Sort Aggregate Memory Ratio
+//===--------------------------------------------------------------------===//
+void SortAggregateMemoryRatioSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).sort_aggregate_memory_ratio = ClientConfig().sort_aggregate_memory_ratio;
+}
+
+void SortAggregateMemoryRatioSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto ratio = input.GetValue<double>();
+	if (ratio < 0) {
+		throw InvalidInputException("the sort aggregate memory ratio must be positive (or 0 to disable it)");
+	}
+	ClientConfig::GetConfig(context).sort_aggregate_memory_ratio = ratio;
+}
+
+Value SortAggregateMemoryRatioSetting::GetSetting(const ClientContext &context) {
+	return Value::DOUBLE(ClientConfig::GetConfig(context).sort_aggregate_memory_ratio);
+}
+
 //===--------------------------------------------------------------------===//
 // Pivot Filter Threshold
 //===--------------------------------------------------------------------===//
@@ -1974,6 +2099,143 @@ Value AllocatorBackgroundThreadsSetting::GetSetting(const ClientContext &context
 	return Value(config.options.allocator_background_threads);
 }
 
+//===--------------------------------------------------------------------===//
+// Pin Threads
+//===--------------------------------------------------------------------===//
+void PinThreadsSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto parameter = StringUtil::Lower(input.ToString());
+	if (parameter == "on" || parameter == "true") {
+		config.options.pin_threads = ThreadPinMode::ON;
+	} else if (parameter == "off" || parameter == "false") {
+		config.options.pin_threads = ThreadPinMode::OFF;
+	} else if (parameter == "auto") {
+		config.options.pin_threads = ThreadPinMode::AUTO;
+	} else {
+		throw InvalidInputException("Unrecognized parameter for option PIN_THREADS \"%s\". Expected ON, OFF or AUTO.",
+		                            parameter);
+	}
+	if (db) {
+		TaskScheduler::GetScheduler(*db).RelaunchThreads();
+	}
+}
+
+void PinThreadsSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.pin_threads = DBConfig().options.pin_threads;
+	if (db) {
+		TaskScheduler::GetScheduler(*db).RelaunchThreads();
+	}
+}
+
+Value PinThreadsSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	switch (config.options.pin_threads) {
+	case ThreadPinMode::ON:
+		return "on";
+	case ThreadPinMode::OFF:
+		return "off";
+	case ThreadPinMode::AUTO:
+		return "auto";
+	default:
+		throw InternalException("Unknown pin threads setting");
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Fair Scheduling
+//===--------------------------------------------------------------------===//
+void FairSchedulingSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.fair_scheduling = input.GetValue<bool>();
+}
+
+void FairSchedulingSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.fair_scheduling = DBConfig().options.fair_scheduling;
+}
+
+Value FairSchedulingSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.fair_scheduling);
+}
+
+//===--------------------------------------------------------------------===//
+// Scheduler Weight
+//===--------------------------------------------------------------------===//
+void SchedulerWeightSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto new_weight = input.GetValue<uint64_t>();
+	if (new_weight == 0 || new_weight > TaskScheduler::MAXIMUM_PRODUCER_WEIGHT) {
+		throw InvalidInputException("scheduler_weight must be between 1 and %llu",
+		                            TaskScheduler::MAXIMUM_PRODUCER_WEIGHT);
+	}
+	ClientConfig::GetConfig(context).scheduler_weight = new_weight;
+}
+
+void SchedulerWeightSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).scheduler_weight = ClientConfig().scheduler_weight;
+}
+
+Value SchedulerWeightSetting::GetSetting(const ClientContext &context) {
+	return Value::UBIGINT(ClientConfig::GetConfig(context).scheduler_weight);
+}
+
+//===--------------------------------------------------------------------===//
+// Admission Timeout
+//===--------------------------------------------------------------------===//
+void AdmissionTimeoutSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.admission_timeout = input.GetValue<uint64_t>();
+}
+
+void AdmissionTimeoutSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.admission_timeout = DBConfig().options.admission_timeout;
+}
+
+Value AdmissionTimeoutSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.admission_timeout);
+}
+
+//===--------------------------------------------------------------------===//
+// Plan Cache Size
+//===--------------------------------------------------------------------===//
+void PlanCacheSizeSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.plan_cache_size = input.GetValue<uint64_t>();
+	if (db) {
+		db->GetPlanCache().Clear();
+	}
+}
+
+void PlanCacheSizeSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.plan_cache_size = DBConfig().options.plan_cache_size;
+	if (db) {
+		db->GetPlanCache().Clear();
+	}
+}
+
+Value PlanCacheSizeSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.plan_cache_size);
+}
+
+//===--------------------------------------------------------------------===//
+// Result Cache Memory Limit
+//===--------------------------------------------------------------------===//
+void ResultCacheMemoryLimitSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.result_cache_memory_limit = DBConfig::ParseMemoryLimit(input.ToString());
+	if (db) {
+		db->GetResultCache().Clear();
+	}
+}
+
+void ResultCacheMemoryLimitSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.result_cache_memory_limit = DBConfig().options.result_cache_memory_limit;
+	if (db) {
+		db->GetResultCache().Clear();
+	}
+}
+
+Value ResultCacheMemoryLimitSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(StringUtil::BytesToHumanReadableString(config.options.result_cache_memory_limit));
+}
+
 //===--------------------------------------------------------------------===//
 // DuckDBApi Setting
 //===--------------------------------------------------------------------===//
@@ -12,6 +12,7 @@
 #include "duckdb/planner/expression/bound_operator_expression.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/optimizer/optimizer.hpp"
@@ -435,7 +436,8 @@ static unique_ptr<TableFilter> PushDownFilterIntoExpr(const Expression &expr, un
 	return inner_filter;
 }
 
-TableFilterSet FilterCombiner::GenerateTableScanFilters(const vector<idx_t> &column_ids) {
+TableFilterSet FilterCombiner::GenerateTableScanFilters(const vector<idx_t> &column_ids,
+                                                        const unordered_set<idx_t> &in_filter_columns) {
 	TableFilterSet table_filters;
 	//! First, we figure the filters that have constant expressions that we can push down to the table scan
 	for (auto &constant_value : constant_values) {
@@ -595,29 +597,36 @@ TableFilterSet FilterCombiner::GenerateTableScanFilters(const vector<idx_t> &col
 
 			//! Check if values are consecutive, if yes transform them to >= <= (only for integers)
 			// e.g. if we have x IN (1, 2, 3, 4, 5) we transform this into x >= 1 AND x <= 5
-			if (!type.IsIntegral()) {
-				continue;
-			}
-
-			for (idx_t i = 1; i < func.children.size(); i++) {
-				auto &const_value_expr = func.children[i]->Cast<BoundConstantExpression>();
-				D_ASSERT(!const_value_expr.value.IsNull());
-				in_values.push_back(const_value_expr.value.GetValue<hugeint_t>());
-			}
-			if (in_values.empty()) {
-				continue;
-			}
-
-			sort(in_values.begin(), in_values.end());
-
-			bool can_simplify_in_clause = true;
-			for (idx_t in_val_idx = 1; in_val_idx < in_values.size(); in_val_idx++) {
-				if (in_values[in_val_idx] - in_values[in_val_idx - 1] > 1) {
-					can_simplify_in_clause = false;
-					break;
+			bool can_simplify_in_clause = type.IsIntegral();
+			if (can_simplify_in_clause) {
+				for (idx_t i = 1; i < func.children.size(); i++) {
+					auto &const_value_expr = func.children[i]->Cast<BoundConstantExpression>();
+					D_ASSERT(!const_value_expr.value.IsNull());
+					in_values.push_back(const_value_expr.value.GetValue<hugeint_t>());
+				}
+				sort(in_values.begin(), in_values.end());
+				for (idx_t in_val_idx = 1; in_val_idx < in_values.size(); in_val_idx++) {
+					if (in_values[in_val_idx] - in_values[in_val_idx - 1] > 1) {
+						can_simplify_in_clause = false;
+						break;
+					}
 				}
 			}
 			if (!can_simplify_in_clause) {
+				// otherwise push the values as an IN filter if the column has a bloom filter that can prune row groups
+				// other IN lists are better evaluated as an expression (or a mark join) than value-by-value in the scan
+				if (in_filter_columns.find(column_index) == in_filter_columns.end()) {
+					continue;
+				}
+				if (!type.IsNumeric() && type.id() != LogicalTypeId::VARCHAR) {
+					continue;
+				}
+				vector<Value> values;
+				for (idx_t i = 1; i < func.children.size(); i++) {
+					values.push_back(func.children[i]->Cast<BoundConstantExpression>().value);
+				}
+				table_filters.PushFilter(column_index, make_uniq<InFilter>(std::move(values)));
+				remaining_filters.erase_at(rem_fil_idx);
 				continue;
 			}
 			auto lower_bound = make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO,
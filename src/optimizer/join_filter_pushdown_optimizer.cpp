@@ -1,5 +1,7 @@
 #include "duckdb/optimizer/join_filter_pushdown_optimizer.hpp"
+#include "duckdb/planner/operator/logical_aggregate.hpp"
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
+#include "duckdb/planner/operator/logical_distinct.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/planner/operator/logical_projection.hpp"
 #include "duckdb/execution/operator/join/join_filter_pushdown.hpp"
@@ -60,70 +62,31 @@ void JoinFilterPushdownOptimizer::GenerateJoinFilters(LogicalComparisonJoin &joi
 		pushdown_col.probe_column_index = colref.binding;
 		pushdown_info->filters.push_back(pushdown_col);
 	}
-	if (pushdown_info->filters.empty()) {
-		// could not generate any filters - bail-out
-		return;
-	}
-	// find the child LogicalGet (if possible)
-	reference<LogicalOperator> probe_source(*join.children[0]);
-	while (probe_source.get().type != LogicalOperatorType::LOGICAL_GET) {
-		auto &probe_child = probe_source.get();
-		switch (probe_child.type) {
-		case LogicalOperatorType::LOGICAL_LIMIT:
-		case LogicalOperatorType::LOGICAL_FILTER:
-		case LogicalOperatorType::LOGICAL_ORDER_BY:
-		case LogicalOperatorType::LOGICAL_TOP_N:
-		case LogicalOperatorType::LOGICAL_DISTINCT:
-		case LogicalOperatorType::LOGICAL_COMPARISON_JOIN:
-		case LogicalOperatorType::LOGICAL_CROSS_PRODUCT:
-			// does not affect probe side - continue into left child
-			// FIXME: we can probably recurse into more operators here (e.g. window, set operation, unnest)
-			probe_source = *probe_child.children[0];
-			break;
-		case LogicalOperatorType::LOGICAL_PROJECTION: {
-			// projection - check if we all of the expressions are only column references
-			auto &proj = probe_source.get().Cast<LogicalProjection>();
-			for (auto &filter : pushdown_info->filters) {
-				if (filter.probe_column_index.table_index != proj.table_index) {
-					// index does not belong to this projection - bail-out
-					return;
-				}
-				auto &expr = *proj.expressions[filter.probe_column_index.column_index];
-				if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
-					// not a simple column ref - bail-out
-					return;
-				}
-				// column-ref - pass through the new column binding
-				auto &colref = expr.Cast<BoundColumnRefExpression>();
-				filter.probe_column_index = colref.binding;
-			}
-			probe_source = *probe_child.children[0];
-			break;
-		}
-		default:
-			// unsupported child type
-			return;
-		}
-	}
-	// found the LogicalGet
-	auto &get = probe_source.get().Cast<LogicalGet>();
-	if (!get.function.filter_pushdown) {
-		// filter pushdown is not supported - bail-out
-		return;
-	}
+	// find the LogicalGet that produces each of the probe columns (if possible)
+	vector<JoinFilterPushdownColumn> pushdown_filters;
 	for (auto &filter : pushdown_info->filters) {
-		if (filter.probe_column_index.table_index != get.table_index) {
-			// the filter does not apply to the probe side here - bail-out
-			return;
+		bool crosses_pipelines = false;
+		auto get = FindProbeSource(*join.children[0], filter.probe_column_index, crosses_pipelines);
+		if (!get || !get->function.filter_pushdown) {
+			// could not find a source that supports filter pushdown - skip this filter
+			continue;
+		}
+		pushdown_info->crosses_pipelines = pushdown_info->crosses_pipelines || crosses_pipelines;
+		// set up the dynamic filters (if we don't have any yet)
+		if (!get->dynamic_filters) {
+			get->dynamic_filters = make_shared_ptr<DynamicTableFilterSet>();
 		}
+		filter.dynamic_filters = get->dynamic_filters;
+		pushdown_filters.push_back(std::move(filter));
 	}
-	// pushdown can be performed
+	pushdown_info->filters.clear();
 
 	// set up the min/max aggregates for each of the filters
 	vector<AggregateFunction> aggr_functions;
 	aggr_functions.push_back(MinFun::GetFunction());
 	aggr_functions.push_back(MaxFun::GetFunction());
-	for (auto &filter : pushdown_info->filters) {
+	for (auto &filter : pushdown_filters) {
+		vector<unique_ptr<Expression>> min_max_aggregates;
 		for (auto &aggr : aggr_functions) {
 			FunctionBinder function_binder(optimizer.GetContext());
 			vector<unique_ptr<Expression>> aggr_children;
@@ -132,21 +95,137 @@ void JoinFilterPushdownOptimizer::GenerateJoinFilters(LogicalComparisonJoin &joi
 			                                                       AggregateType::NON_DISTINCT);
 			if (aggr_expr->children.size() != 1) {
 				// min/max with collation - not supported
-				return;
+				break;
 			}
+			min_max_aggregates.push_back(std::move(aggr_expr));
+		}
+		if (min_max_aggregates.size() != aggr_functions.size()) {
+			continue;
+		}
+		for (auto &aggr_expr : min_max_aggregates) {
 			pushdown_info->min_max_aggregates.push_back(std::move(aggr_expr));
 		}
+		pushdown_info->filters.push_back(std::move(filter));
 	}
-	// set up the dynamic filters (if we don't have any yet)
-	if (!get.dynamic_filters) {
-		get.dynamic_filters = make_shared_ptr<DynamicTableFilterSet>();
+	if (pushdown_info->filters.empty()) {
+		// could not push any filters - bail-out
+		return;
 	}
-	pushdown_info->dynamic_filters = get.dynamic_filters;
 
 	// set up the filter pushdown in the join itself
 	join.filter_pushdown = std::move(pushdown_info);
 }
 
+static bool ProducesBinding(LogicalOperator &op, const ColumnBinding &binding) {
+	for (auto &child_binding : op.GetColumnBindings()) {
+		if (child_binding == binding) {
+			return true;
+		}
+	}
+	return false;
+}
+
+optional_ptr<LogicalGet> JoinFilterPushdownOptimizer::FindProbeSource(LogicalOperator &probe_child,
+                                                                     ColumnBinding &binding,
+                                                                     bool &crosses_pipelines) {
+	// removing rows from the source only ever removes rows with a value for this column that is not in the build side
+	// we can look through any operator that passes on the column as-is, as long as the rows that are removed do not
+	// affect any of the other rows (e.g., we cannot look through a LIMIT)
+	reference<LogicalOperator> probe_source(probe_child);
+	while (probe_source.get().type != LogicalOperatorType::LOGICAL_GET) {
+		auto &op = probe_source.get();
+		switch (op.type) {
+		case LogicalOperatorType::LOGICAL_FILTER:
+		case LogicalOperatorType::LOGICAL_ORDER_BY:
+			// does not affect probe side - continue into left child
+			// FIXME: we can probably recurse into more operators here (e.g. window, set operation, unnest)
+			probe_source = *op.children[0];
+			break;
+		case LogicalOperatorType::LOGICAL_DISTINCT:
+			if (op.Cast<LogicalDistinct>().distinct_type != DistinctType::DISTINCT) {
+				// DISTINCT ON picks a row per group - removing rows can change which row is picked
+				return nullptr;
+			}
+			probe_source = *op.children[0];
+			break;
+		case LogicalOperatorType::LOGICAL_COMPARISON_JOIN:
+		case LogicalOperatorType::LOGICAL_ANY_JOIN:
+		case LogicalOperatorType::LOGICAL_CROSS_PRODUCT: {
+			// continue into the side of the join that produces the column
+			if (ProducesBinding(*op.children[0], binding)) {
+				probe_source = *op.children[0];
+				break;
+			}
+			if (!ProducesBinding(*op.children[1], binding)) {
+				// e.g. the MARK column of a MARK join
+				return nullptr;
+			}
+			if (op.type != LogicalOperatorType::LOGICAL_CROSS_PRODUCT) {
+				switch (op.Cast<LogicalJoin>().join_type) {
+				case JoinType::INNER:
+				case JoinType::LEFT:
+				case JoinType::RIGHT:
+				case JoinType::OUTER:
+					break;
+				default:
+					// e.g. SINGLE - the RHS determines whether or not the join throws an error
+					return nullptr;
+				}
+			}
+			// the build side is a separate pipeline
+			crosses_pipelines = true;
+			probe_source = *op.children[1];
+			break;
+		}
+		case LogicalOperatorType::LOGICAL_PROJECTION: {
+			// projection - check if the expression is a column reference
+			auto &proj = op.Cast<LogicalProjection>();
+			if (binding.table_index != proj.table_index) {
+				// index does not belong to this projection - bail-out
+				return nullptr;
+			}
+			auto &expr = *proj.expressions[binding.column_index];
+			if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+				// not a simple column ref - bail-out
+				return nullptr;
+			}
+			// column-ref - pass through the new column binding
+			binding = expr.Cast<BoundColumnRefExpression>().binding;
+			probe_source = *op.children[0];
+			break;
+		}
+		case LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY: {
+			// aggregate - we can filter the input on the groups
+			auto &aggr = op.Cast<LogicalAggregate>();
+			if (binding.table_index != aggr.group_index || aggr.grouping_sets.size() > 1) {
+				// not a group, or the group is not in every grouping set - bail-out
+				return nullptr;
+			}
+			auto &expr = *aggr.groups[binding.column_index];
+			if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+				// not a simple column ref - bail-out
+				return nullptr;
+			}
+			binding = expr.Cast<BoundColumnRefExpression>().binding;
+			// the aggregate is a separate pipeline
+			crosses_pipelines = true;
+			probe_source = *op.children[0];
+			break;
+		}
+		default:
+			// unsupported child type
+			return nullptr;
+		}
+	}
+	// found the LogicalGet
+	auto &get = probe_source.get().Cast<LogicalGet>();
+	if (binding.table_index != get.table_index) {
+		// the filter does not apply to the probe side here - bail-out
+		return nullptr;
+	}
+	return &get;
+}
+
 void JoinFilterPushdownOptimizer::VisitOperator(LogicalOperator &op) {
 	if (op.type == LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
 		// comparison join - try to generate join filters (if possible)
@@ -1,11 +1,34 @@
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/execution/index/bloom_index.hpp"
 #include "duckdb/optimizer/filter_pushdown.hpp"
 #include "duckdb/optimizer/optimizer.hpp"
 #include "duckdb/planner/expression/bound_columnref_expression.hpp"
 #include "duckdb/planner/expression/bound_parameter_expression.hpp"
 #include "duckdb/planner/operator/logical_filter.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/storage/table/data_table_info.hpp"
 
 namespace duckdb {
+
+//! Returns the (logical) columns of the scanned table that have a BLOOM index
+static unordered_set<idx_t> GetBloomFilterColumns(LogicalGet &get) {
+	unordered_set<idx_t> result;
+	auto table = get.GetTable();
+	if (!table || !table->IsDuckTable()) {
+		return result;
+	}
+	auto &columns = table->GetColumns();
+	table->GetStorage().GetDataTableInfo()->GetIndexes().Scan([&](Index &index) {
+		if (index.GetIndexType() == BloomIndex::TYPE_NAME) {
+			for (auto &column_id : index.GetColumnIds()) {
+				result.insert(columns.PhysicalToLogical(PhysicalIndex(column_id)).index);
+			}
+		}
+		return false;
+	});
+	return result;
+}
+
 unique_ptr<LogicalOperator> FilterPushdown::PushdownGet(unique_ptr<LogicalOperator> op) {
 	D_ASSERT(op->type == LogicalOperatorType::LOGICAL_GET);
 	auto &get = op->Cast<LogicalGet>();
@@ -52,7 +75,7 @@ unique_ptr<LogicalOperator> FilterPushdown::PushdownGet(unique_ptr<LogicalOperat
 
 	//! We generate the table filters that will be executed during the table scan
 	//! Right now this only executes simple AND filters
-	get.table_filters = combiner.GenerateTableScanFilters(get.GetColumnIds());
+	get.table_filters = combiner.GenerateTableScanFilters(get.GetColumnIds(), GetBloomFilterColumns(get));
 
 	GenerateFilters();
 
@@ -1,8 +1,11 @@
 #include "duckdb/optimizer/topn_optimizer.hpp"
 
 #include "duckdb/common/limits.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/planner/operator/logical_limit.hpp"
 #include "duckdb/planner/operator/logical_order.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
 #include "duckdb/planner/operator/logical_top_n.hpp"
 
 namespace duckdb {
@@ -32,6 +35,69 @@ bool TopN::CanOptimize(LogicalOperator &op) {
 	return false;
 }
 
+void TopN::PushdownDynamicFilters(LogicalTopN &op) {
+	// the top-n can only ever emit rows that are at least as good as its current boundary value
+	// we push a filter on the first ordering column into the scan, so it can skip the rows that cannot be emitted
+	auto &order = op.orders[0];
+	if (order.null_order != OrderByNullType::NULLS_LAST) {
+		// NULL values are emitted before the boundary value, but are filtered out by the comparison
+		return;
+	}
+	if (order.expression->type != ExpressionType::BOUND_COLUMN_REF) {
+		// only bound column ref supported for now
+		return;
+	}
+	auto &type = order.expression->return_type;
+	if (type.IsNested() || type.id() == LogicalTypeId::INTERVAL) {
+		// nested columns and intervals are not supported for pushdown
+		return;
+	}
+	if (type.id() == LogicalTypeId::VARCHAR && !StringType::GetCollation(type).empty()) {
+		// collated strings are not ordered by their value
+		return;
+	}
+	// find the LogicalGet that produces the column
+	// we can only look through operators that are part of the same pipeline and pass on the column as-is
+	auto binding = order.expression->Cast<BoundColumnRefExpression>().binding;
+	reference<LogicalOperator> child(*op.children[0]);
+	while (child.get().type != LogicalOperatorType::LOGICAL_GET) {
+		auto &child_op = child.get();
+		switch (child_op.type) {
+		case LogicalOperatorType::LOGICAL_FILTER:
+			child = *child_op.children[0];
+			break;
+		case LogicalOperatorType::LOGICAL_PROJECTION: {
+			auto &proj = child_op.Cast<LogicalProjection>();
+			if (binding.table_index != proj.table_index) {
+				return;
+			}
+			auto &expr = *proj.expressions[binding.column_index];
+			if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+				return;
+			}
+			binding = expr.Cast<BoundColumnRefExpression>().binding;
+			child = *child_op.children[0];
+			break;
+		}
+		default:
+			return;
+		}
+	}
+	auto &get = child.get().Cast<LogicalGet>();
+	if (binding.table_index != get.table_index || !get.function.filter_pushdown) {
+		return;
+	}
+	auto &column_ids = get.GetColumnIds();
+	if (binding.column_index >= column_ids.size() || IsRowIdColumnId(column_ids[binding.column_index])) {
+		return;
+	}
+	if (!get.dynamic_filters) {
+		get.dynamic_filters = make_shared_ptr<DynamicTableFilterSet>();
+	}
+	op.dynamic_filters = get.dynamic_filters;
+	op.dynamic_filter_column = binding.column_index;
+}
+
 unique_ptr<LogicalOperator> TopN::Optimize(unique_ptr<LogicalOperator> op) {
 	if (CanOptimize(*op)) {
 
@@ -62,6 +128,7 @@ unique_ptr<LogicalOperator> TopN::Optimize(unique_ptr<LogicalOperator> op) {
 		}
 		auto topn = make_uniq<LogicalTopN>(std::move(order_by.orders), limit_val, offset_val);
 		topn->AddChild(std::move(order_by.children[0]));
+		PushdownDynamicFilters(*topn);
 		auto cardinality = limit_val;
 		if (topn->children[0]->has_estimated_cardinality && topn->children[0]->estimated_cardinality < limit_val) {
 			cardinality = topn->children[0]->estimated_cardinality;
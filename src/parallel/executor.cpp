@@ -17,6 +17,7 @@
 #include "duckdb/parallel/pipeline_prepare_finish_event.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parallel/thread_context.hpp"
+#include "duckdb/storage/temporary_memory_manager.hpp"
 
 #include <algorithm>
 #include <chrono>
@@ -387,13 +388,15 @@ void Executor::Initialize(PhysicalOperator &plan) {
 void Executor::InitializeInternal(PhysicalOperator &plan) {
 
 	auto &scheduler = TaskScheduler::GetScheduler(context);
+	// hold back the query while other queries are short on memory
+	TemporaryMemoryManager::Get(context).WaitForAdmission(context);
 	{
 		lock_guard<mutex> elock(executor_lock);
 		physical_plan = &plan;
 
 		this->profiler = ClientData::Get(context).profiler;
 		profiler->Initialize(plan);
-		this->producer = scheduler.CreateProducer();
+		this->producer = scheduler.CreateProducer(ClientConfig::GetConfig(context).scheduler_weight);
 
 		// build and ready the pipelines
 		PipelineBuildState state;
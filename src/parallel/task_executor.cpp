@@ -35,16 +35,17 @@ void TaskExecutor::FinishTask() {
 
 void TaskExecutor::WorkOnTasks() {
 	// repeatedly execute tasks until we are finished
+	// tasks can schedule new tasks - keep on looking for tasks while waiting for the active tasks to finish
 	shared_ptr<Task> task_from_producer;
-	while (scheduler.GetTaskFromProducer(*token, task_from_producer)) {
+	while (completed_tasks != total_tasks) {
+		if (!scheduler.GetTaskFromProducer(*token, task_from_producer)) {
+			continue;
+		}
 		auto res = task_from_producer->Execute(TaskExecutionMode::PROCESS_ALL);
 		(void)res;
 		D_ASSERT(res != TaskExecutionResult::TASK_BLOCKED);
 		task_from_producer.reset();
 	}
-	// wait for all active tasks to finish
-	while (completed_tasks != total_tasks) {
-	}
 
 	// check if we ran into any errors while checkpointing
 	if (HasError()) {
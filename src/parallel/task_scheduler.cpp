@@ -23,6 +23,10 @@
 #include <unistd.h>
 #endif
 
+#if defined(__linux__) && !defined(DUCKDB_NO_THREADS)
+#include <pthread.h>
+#endif
+
 namespace duckdb {
 
 struct SchedulerThread {
@@ -56,6 +60,7 @@ struct QueueProducerToken {
 void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
 	lock_guard<mutex> producer_lock(token.producer_lock);
 	if (q.enqueue(token.token->queue_token, std::move(task))) {
+		token.queued_tasks++;
 		semaphore.signal();
 	} else {
 		throw InternalException("Could not schedule task!");
@@ -64,7 +69,14 @@ void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
 
 bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
 	lock_guard<mutex> producer_lock(token.producer_lock);
-	return q.try_dequeue_from_producer(token.token->queue_token, task);
+	if (!q.try_dequeue_from_producer(token.token->queue_token, task)) {
+		// tasks that are dequeued without their producer (if fair scheduling is disabled) are not subtracted from the
+		// queued tasks: the queue of the producer is empty, so we can reset them here (enqueueing holds the lock)
+		token.queued_tasks = 0;
+		return false;
+	}
+	token.queued_tasks--;
+	return true;
 }
 
 #else
@@ -79,6 +91,7 @@ struct ConcurrentQueue {
 void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
 	lock_guard<mutex> lock(qlock);
 	q[std::ref(*token.token)].push(std::move(task));
+	token.queued_tasks++;
 }
 
 bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
@@ -92,6 +105,7 @@ bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task>
 
 	task = std::move(it->second.front());
 	it->second.pop();
+	token.queued_tasks--;
 
 	return true;
 }
@@ -111,17 +125,19 @@ private:
 #endif
 
 ProducerToken::ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token)
-    : scheduler(scheduler), token(std::move(token)) {
+    : scheduler(scheduler), token(std::move(token)), weight(TaskScheduler::DEFAULT_PRODUCER_WEIGHT), virtual_time(0),
+      queued_tasks(0) {
 }
 
 ProducerToken::~ProducerToken() {
+	scheduler.RemoveProducer(*this);
 }
 
 TaskScheduler::TaskScheduler(DatabaseInstance &db)
     : db(db), queue(make_uniq<ConcurrentQueue>()),
       allocator_flush_threshold(db.config.options.allocator_flush_threshold),
       allocator_background_threads(db.config.options.allocator_background_threads), requested_thread_count(0),
-      current_thread_count(1) {
+      current_thread_count(1), background_thread_count(0) {
 	SetAllocatorBackgroundThreads(db.config.options.allocator_background_threads);
 }
 
@@ -143,9 +159,67 @@ TaskScheduler &TaskScheduler::GetScheduler(DatabaseInstance &db) {
 	return db.GetScheduler();
 }
 
-unique_ptr<ProducerToken> TaskScheduler::CreateProducer() {
+unique_ptr<ProducerToken> TaskScheduler::CreateProducer(idx_t weight) {
 	auto token = make_uniq<QueueProducerToken>(*queue);
-	return make_uniq<ProducerToken>(*this, std::move(token));
+	auto result = make_uniq<ProducerToken>(*this, std::move(token));
+	result->weight = MaxValue<idx_t>(MinValue<idx_t>(weight, MAXIMUM_PRODUCER_WEIGHT), 1);
+
+	lock_guard<mutex> guard(producer_lock);
+	// a new producer starts at the lowest virtual time of the existing producers - starting at 0 would let it
+	// monopolize the threads until it has caught up with producers that have been running for a long time
+	optional_idx min_virtual_time;
+	for (auto &producer : producers) {
+		auto virtual_time = producer.get().virtual_time.load();
+		if (!min_virtual_time.IsValid() || virtual_time < min_virtual_time.GetIndex()) {
+			min_virtual_time = virtual_time;
+		}
+	}
+	if (min_virtual_time.IsValid()) {
+		result->virtual_time = min_virtual_time.GetIndex();
+	}
+	producers.push_back(*result);
+	return result;
+}
+
+void TaskScheduler::RemoveProducer(ProducerToken &token) {
+	lock_guard<mutex> guard(producer_lock);
+	for (idx_t i = 0; i < producers.size(); i++) {
+		if (RefersToSameObject(producers[i].get(), token)) {
+			producers[i] = producers.back();
+			producers.pop_back();
+			return;
+		}
+	}
+}
+
+bool TaskScheduler::DequeueTask(shared_ptr<Task> &task) {
+#ifndef DUCKDB_NO_THREADS
+	if (!DBConfig::GetConfig(db).options.fair_scheduling) {
+		// take the tasks in the order in which they were scheduled, without locking
+		return queue->q.try_dequeue(task);
+	}
+#endif
+	// holding the lock prevents producers from being destroyed while we dequeue from them
+	lock_guard<mutex> guard(producer_lock);
+	while (true) {
+		optional_ptr<ProducerToken> next_producer;
+		for (auto &entry : producers) {
+			auto &producer = entry.get();
+			if (producer.queued_tasks > 0 &&
+			    (!next_producer || producer.virtual_time < next_producer->virtual_time)) {
+				next_producer = producer;
+			}
+		}
+		if (!next_producer) {
+			return false;
+		}
+		// this can fail if another thread took the last task of this producer in the meantime
+		// in that case the queued tasks of the producer are reset, and we try the next producer
+		if (queue->DequeueFromProducer(*next_producer, task)) {
+			next_producer->virtual_time += MAXIMUM_PRODUCER_WEIGHT / next_producer->weight;
+			return true;
+		}
+	}
 }
 
 void TaskScheduler::ScheduleTask(ProducerToken &token, shared_ptr<Task> task) {
@@ -185,7 +259,7 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 				}
 			}
 		}
-		if (queue->q.try_dequeue(task)) {
+		if (DequeueTask(task)) {
 			auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
 
 			switch (execute_result) {
@@ -218,7 +292,7 @@ idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 	// loop until the marker is set to false
 	while (*marker && completed_tasks < max_tasks) {
 		shared_ptr<Task> task;
-		if (!queue->q.try_dequeue(task)) {
+		if (!DequeueTask(task)) {
 			return completed_tasks;
 		}
 		auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
@@ -248,7 +322,7 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 	shared_ptr<Task> task;
 	for (idx_t i = 0; i < max_tasks; i++) {
 		queue->semaphore.wait(TASK_TIMEOUT_USECS);
-		if (!queue->q.try_dequeue(task)) {
+		if (!DequeueTask(task)) {
 			return;
 		}
 		try {
@@ -284,6 +358,10 @@ int32_t TaskScheduler::NumberOfThreads() {
 	return current_thread_count.load();
 }
 
+idx_t TaskScheduler::NumberOfBackgroundThreads() {
+	return background_thread_count.load();
+}
+
 void TaskScheduler::SetThreads(idx_t total_threads, idx_t external_threads) {
 	if (total_threads == 0) {
 		throw SyntaxException("Number of threads must be positive!");
@@ -363,6 +441,8 @@ void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 	auto new_thread_count = NumericCast<idx_t>(n);
 	if (threads.size() == new_thread_count) {
 		current_thread_count = NumericCast<int32_t>(threads.size() + config.options.external_threads);
+		background_thread_count = threads.size();
+		SetThreadAffinity();
 		return;
 	}
 	if (threads.size() > new_thread_count) {
@@ -400,10 +480,58 @@ void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 		}
 	}
 	current_thread_count = NumericCast<int32_t>(threads.size() + config.options.external_threads);
+	background_thread_count = threads.size();
+	SetThreadAffinity();
 	if (Allocator::SupportsFlush()) {
 		Allocator::FlushAll();
 	}
 #endif
 }
 
+void TaskScheduler::SetThreadAffinity() {
+#if defined(__linux__) && !defined(DUCKDB_NO_THREADS)
+	auto &config = DBConfig::GetConfig(db);
+	// the cores that we are allowed to run on (e.g., restricted by taskset or a container)
+	cpu_set_t allowed_cpus;
+	CPU_ZERO(&allowed_cpus);
+	if (sched_getaffinity(0, sizeof(allowed_cpus), &allowed_cpus) != 0) {
+		return;
+	}
+	vector<int> cpus;
+	for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+		if (CPU_ISSET(cpu, &allowed_cpus)) {
+			cpus.push_back(cpu);
+		}
+	}
+	if (cpus.empty()) {
+		return;
+	}
+	bool pin_threads;
+	switch (config.options.pin_threads) {
+	case ThreadPinMode::ON:
+		pin_threads = true;
+		break;
+	case ThreadPinMode::OFF:
+		pin_threads = false;
+		break;
+	default:
+		// on machines with many cores (typically with multiple NUMA nodes), threads that move between cores lose their
+		// caches and end up far from the memory they allocated
+		pin_threads = cpus.size() > THREAD_PIN_THRESHOLD;
+		break;
+	}
+	for (idx_t i = 0; i < threads.size(); i++) {
+		cpu_set_t thread_cpus = allowed_cpus;
+		if (pin_threads) {
+			// the external threads (e.g., the main thread) are not pinned, but they do run tasks
+			// so we skip the first cores, and assign the background threads to the remaining cores round-robin
+			CPU_ZERO(&thread_cpus);
+			CPU_SET(cpus[(i + config.options.external_threads) % cpus.size()], &thread_cpus);
+		}
+		// this fails if the core is not available (anymore) - we just leave the thread as-is in that case
+		pthread_setaffinity_np(threads[i]->internal_thread->native_handle(), sizeof(thread_cpus), &thread_cpus);
+	}
+#endif
+}
+
 } // namespace duckdb
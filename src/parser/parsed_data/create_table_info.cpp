@@ -2,6 +2,7 @@
 #include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/catalog/catalog.hpp"
+#include "duckdb/parser/keyword_helper.hpp"
 
 namespace duckdb {
 
@@ -26,6 +27,7 @@ unique_ptr<CreateInfo> CreateTableInfo::Copy() const {
 	if (query) {
 		result->query = unique_ptr_cast<SQLStatement, SelectStatement>(query->Copy());
 	}
+	result->sort_keys = sort_keys;
 	return std::move(result);
 }
 
@@ -49,7 +51,16 @@ string CreateTableInfo::ToString() const {
 	if (query != nullptr) {
 		ret += " AS " + query->ToString();
 	} else {
-		ret += TableCatalogEntry::ColumnsToSQL(columns, constraints) + ";";
+		ret += TableCatalogEntry::ColumnsToSQL(columns, constraints);
+		if (!sort_keys.empty()) {
+			string keys;
+			for (auto &key : sort_keys) {
+				keys += keys.empty() ? "" : ", ";
+				keys += KeywordHelper::WriteOptionallyQuoted(key);
+			}
+			ret += " WITH (order_by = " + KeywordHelper::WriteQuoted(keys) + ")";
+		}
+		ret += ";";
 	}
 	return ret;
 }
@@ -66,6 +66,56 @@ ColumnDefinition Transformer::TransformColumnDefinition(duckdb_libpgquery::PGCol
 	return ColumnDefinition(colname, target_type);
 }
 
+//! Splits the order_by option of a table into its (optionally quoted) column names
+//! Note that we cannot invoke the parser here: it is not re-entrant while the CREATE TABLE statement is transformed
+static vector<string> TransformSortKeys(const string &keys) {
+	vector<string> result;
+	idx_t pos = 0;
+	while (true) {
+		while (pos < keys.size() && StringUtil::CharacterIsSpace(keys[pos])) {
+			pos++;
+		}
+		string key;
+		if (pos < keys.size() && keys[pos] == '"') {
+			// quoted column name - two consecutive quotes are an escaped quote
+			pos++;
+			while (true) {
+				if (pos >= keys.size()) {
+					throw ParserException("Unterminated quoted column name in the order_by option \"%s\"", keys);
+				}
+				if (keys[pos] == '"') {
+					if (pos + 1 < keys.size() && keys[pos + 1] == '"') {
+						key += '"';
+						pos += 2;
+						continue;
+					}
+					pos++;
+					break;
+				}
+				key += keys[pos++];
+			}
+		} else {
+			while (pos < keys.size() && (StringUtil::CharacterIsAlpha(keys[pos]) ||
+			                             StringUtil::CharacterIsDigit(keys[pos]) || keys[pos] == '_' ||
+			                             static_cast<unsigned char>(keys[pos]) >= 0x80)) {
+				key += keys[pos++];
+			}
+		}
+		while (pos < keys.size() && StringUtil::CharacterIsSpace(keys[pos])) {
+			pos++;
+		}
+		if (key.empty() || (pos < keys.size() && keys[pos] != ',')) {
+			throw ParserException("The order_by option can only contain column names, not \"%s\"", keys);
+		}
+		result.push_back(std::move(key));
+		if (pos >= keys.size()) {
+			return result;
+		}
+		// skip the comma
+		pos++;
+	}
+}
+
 unique_ptr<CreateStatement> Transformer::TransformCreateTable(duckdb_libpgquery::PGCreateStmt &stmt) {
 	auto result = make_uniq<CreateStatement>();
 	auto info = make_uniq<CreateTableInfo>();
@@ -124,6 +174,21 @@ unique_ptr<CreateStatement> Transformer::TransformCreateTable(duckdb_libpgquery:
 		throw ParserException("Table must have at least one column!");
 	}
 
+	if (stmt.options) {
+		for (auto cell = stmt.options->head; cell != nullptr; cell = cell->next) {
+			auto def_elem = PGPointerCast<duckdb_libpgquery::PGDefElem>(cell->data.ptr_value);
+			if (StringUtil::Lower(def_elem->defname) != "order_by") {
+				// other options (e.g., WITH OIDS) are accepted for compatibility, but ignored
+				continue;
+			}
+			if (!def_elem->arg || def_elem->arg->type != duckdb_libpgquery::T_PGString) {
+				throw ParserException("The order_by option expects a list of column names, e.g. order_by = 'a, b'");
+			}
+			auto &value = *PGPointerCast<duckdb_libpgquery::PGValue>(def_elem->arg);
+			info->sort_keys = TransformSortKeys(value.val.str);
+		}
+	}
+
 	result->info = std::move(info);
 	return result;
 }
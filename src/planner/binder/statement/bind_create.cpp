@@ -3,6 +3,7 @@
 #include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
 #include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/type_catalog_entry.hpp"
+#include "duckdb/execution/index/bloom_index.hpp"
 #include "duckdb/main/secret/secret_manager.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
@@ -576,6 +577,13 @@ unique_ptr<LogicalOperator> DuckCatalog::BindCreateIndex(Binder &binder, CreateS
 	D_ASSERT(plan->type == LogicalOperatorType::LOGICAL_GET);
 	auto &base = stmt.info->Cast<CreateIndexInfo>();
 
+	if (!table.GetSortKeys().empty() && !StringUtil::CIEquals(base.index_type, BloomIndex::TYPE_NAME)) {
+		// sorting the table rewrites its row ids, which only the BLOOM index can tolerate
+		throw BinderException("Cannot create an index of type \"%s\" on sorted table \"%s\": only BLOOM indexes "
+		                      "are supported on tables with a sort key",
+		                      base.index_type, table.name);
+	}
+
 	auto &get = plan->Cast<LogicalGet>();
 	// bind the index expressions
 	IndexBinder index_binder(binder, binder.context);
@@ -351,6 +351,33 @@ unique_ptr<BoundCreateTableInfo> Binder::BindCreateTableInfo(unique_ptr<CreateIn
 		}
 		BindLogicalType(column.TypeMutable(), &result->schema.catalog, result->schema.name);
 	}
+	// verify the columns the table is sorted by
+	case_insensitive_set_t sort_key_set;
+	for (auto &sort_key : base.sort_keys) {
+		if (!base.columns.ColumnExists(sort_key)) {
+			throw BinderException("Table \"%s\" cannot be sorted by column \"%s\": the column does not exist",
+			                      base.table, sort_key);
+		}
+		auto &column = base.columns.GetColumn(sort_key);
+		if (column.Generated()) {
+			throw BinderException("Table \"%s\" cannot be sorted by generated column \"%s\"", base.table, sort_key);
+		}
+		if (!sort_key_set.insert(sort_key).second) {
+			throw BinderException("Column \"%s\" appears twice in the sort key of table \"%s\"", sort_key, base.table);
+		}
+		sort_key = column.Name();
+	}
+	if (!base.sort_keys.empty()) {
+		// PRIMARY KEY, UNIQUE and FOREIGN KEY constraints are backed by ART indexes that point at row ids,
+		// which are rewritten when the table is re-sorted
+		for (auto &constraint : base.constraints) {
+			if (constraint->type == ConstraintType::UNIQUE || constraint->type == ConstraintType::FOREIGN_KEY) {
+				throw BinderException("Table \"%s\" cannot be sorted: sorted tables do not support PRIMARY KEY, "
+				                      "UNIQUE or FOREIGN KEY constraints",
+				                      base.table);
+			}
+		}
+	}
 	result->dependencies.VerifyDependencies(schema.catalog, result->Base().table);
 
 	auto &properties = GetStatementProperties();
@@ -120,6 +120,19 @@ bool BoundWindowExpression::KeysAreCompatible(const BoundWindowExpression &other
 	return true;
 }
 
+bool BoundWindowExpression::FramesAreEquivalent(const BoundWindowExpression &other) const {
+	if (start != other.start || end != other.end) {
+		return false;
+	}
+	if (exclude_clause != other.exclude_clause) {
+		return false;
+	}
+	if (!Expression::Equals(start_expr, other.start_expr) || !Expression::Equals(end_expr, other.end_expr)) {
+		return false;
+	}
+	return KeysAreCompatible(other);
+}
+
 unique_ptr<Expression> BoundWindowExpression::Copy() const {
 	auto new_window = make_uniq<BoundWindowExpression>(type, return_type, nullptr, nullptr);
 	new_window->CopyProperties(*this);
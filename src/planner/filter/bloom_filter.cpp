@@ -0,0 +1,47 @@
+#include "duckdb/planner/filter/bloom_filter.hpp"
+
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+
+namespace duckdb {
+
+BloomTableFilter::BloomTableFilter(LogicalType key_type_p, shared_ptr<BloomFilter> bloom_filter_p)
+    : TableFilter(TableFilterType::BLOOM_FILTER), key_type(std::move(key_type_p)),
+      bloom_filter(std::move(bloom_filter_p)) {
+}
+
+idx_t BloomTableFilter::Filter(Vector &input, idx_t count, SelectionVector &sel, idx_t &approved_tuple_count) const {
+	if (input.GetType() != key_type) {
+		// the hashes are only comparable if the types match (e.g., the scan might read the column in another type)
+		return approved_tuple_count;
+	}
+	return bloom_filter->Filter(input, count, sel, approved_tuple_count);
+}
+
+FilterPropagateResult BloomTableFilter::CheckStatistics(BaseStatistics &stats) {
+	// bloom filters cannot be checked against min/max statistics
+	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+}
+
+string BloomTableFilter::ToString(const string &column_name) {
+	return column_name + " IN BLOOM_FILTER";
+}
+
+bool BloomTableFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<BloomTableFilter>();
+	return other.bloom_filter == bloom_filter;
+}
+
+unique_ptr<TableFilter> BloomTableFilter::Copy() const {
+	return make_uniq<BloomTableFilter>(key_type, bloom_filter);
+}
+
+unique_ptr<Expression> BloomTableFilter::ToExpression(const Expression &column) const {
+	// the bloom filter only ever removes rows that are filtered out later on anyway (e.g., by the join)
+	// so we can conservatively let all rows pass here
+	return make_uniq<BoundConstantExpression>(Value::BOOLEAN(true));
+}
+
+} // namespace duckdb
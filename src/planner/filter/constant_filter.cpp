@@ -14,6 +14,10 @@ ConstantFilter::ConstantFilter(ExpressionType comparison_type_p, Value constant_
 }
 
 FilterPropagateResult ConstantFilter::CheckStatistics(BaseStatistics &stats) {
+	return const_cast<const ConstantFilter &>(*this).CheckStatistics(stats);
+}
+
+FilterPropagateResult ConstantFilter::CheckStatistics(BaseStatistics &stats) const {
 	D_ASSERT(constant.type().id() == stats.GetType().id());
 	switch (constant.type().InternalType()) {
 	case PhysicalType::UINT8:
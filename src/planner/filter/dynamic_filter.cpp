@@ -0,0 +1,67 @@
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+
+namespace duckdb {
+
+DynamicFilterData::DynamicFilterData(ExpressionType comparison_type_p) : comparison_type(comparison_type_p) {
+}
+
+shared_ptr<const ConstantFilter> DynamicFilterData::GetFilter() {
+	lock_guard<mutex> l(lock);
+	return filter;
+}
+
+void DynamicFilterData::SetValue(Value val) {
+	if (val.IsNull()) {
+		// a comparison with NULL never passes - we cannot represent that as a constant filter
+		return;
+	}
+	// the filter can be in use by a scan - replace it instead of modifying it
+	filter = make_shared_ptr<ConstantFilter>(comparison_type, std::move(val));
+}
+
+void DynamicFilterData::Reset() {
+	filter.reset();
+}
+
+DynamicFilter::DynamicFilter(shared_ptr<DynamicFilterData> filter_data_p)
+    : TableFilter(TableFilterType::DYNAMIC_FILTER), filter_data(std::move(filter_data_p)) {
+}
+
+FilterPropagateResult DynamicFilter::CheckStatistics(BaseStatistics &stats) {
+	auto filter = filter_data->GetFilter();
+	if (!filter) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	return filter->CheckStatistics(stats);
+}
+
+string DynamicFilter::ToString(const string &column_name) {
+	auto filter = filter_data->GetFilter();
+	if (!filter) {
+		return "DYNAMIC_FILTER(" + column_name + ")";
+	}
+	return "DYNAMIC_FILTER(" + filter->Copy()->ToString(column_name) + ")";
+}
+
+bool DynamicFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<DynamicFilter>();
+	return other.filter_data == filter_data;
+}
+
+unique_ptr<TableFilter> DynamicFilter::Copy() const {
+	return make_uniq<DynamicFilter>(filter_data);
+}
+
+unique_ptr<Expression> DynamicFilter::ToExpression(const Expression &column) const {
+	// the value of the filter can still change, so we cannot convert it into a (static) expression
+	// dynamic filters only ever remove rows that are not needed by the operator that produced them, so we can
+	// conservatively let all rows pass here
+	return make_uniq<BoundConstantExpression>(Value::BOOLEAN(true));
+}
+
+} // namespace duckdb
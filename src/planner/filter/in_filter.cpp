@@ -0,0 +1,184 @@
+#include "duckdb/planner/filter/in_filter.hpp"
+
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_operator_expression.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+
+InFilter::InFilter(vector<Value> values_p) : TableFilter(TableFilterType::IN_FILTER), values(std::move(values_p)) {
+	if (values.empty()) {
+		throw InternalException("InFilter requires at least one value");
+	}
+	auto &type = values[0].type();
+	values_vector = make_uniq<Vector>(type, values.size());
+	for (idx_t i = 0; i < values.size(); i++) {
+		if (values[i].IsNull()) {
+			throw InternalException("InFilter values cannot be NULL - use IsNullFilter instead");
+		}
+		if (values[i].type() != type) {
+			throw InternalException("InFilter values must all have the same type");
+		}
+		values_vector->SetValue(i, values[i]);
+	}
+	// sort the values by their hash, so we can find the candidate value for a row with a binary search
+	Vector hashes(LogicalType::HASH, values.size());
+	VectorOperations::Hash(*values_vector, hashes, values.size());
+	hashes.Flatten(values.size());
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
+	for (idx_t i = 0; i < values.size(); i++) {
+		value_hashes.emplace_back(hash_data[i], i);
+	}
+	std::sort(value_hashes.begin(), value_hashes.end());
+}
+
+idx_t InFilter::Filter(Vector &input, idx_t count, SelectionVector &sel, idx_t &approved_tuple_count) const {
+	if (approved_tuple_count == 0) {
+		return 0;
+	}
+	if (input.GetType() != values_vector->GetType()) {
+		// the values can only be compared to a column of the same type (e.g., the scan might read the column in
+		// another type) - the filter is only ever created where it is re-checked later on, so let all rows pass
+		return approved_tuple_count;
+	}
+	// this flattens any vector that is not a constant or dictionary vector for all "count" rows
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+
+	Vector hashes(LogicalType::HASH);
+	VectorOperations::Hash(input, hashes, sel, approved_tuple_count);
+	hashes.Flatten(count);
+	const auto hash_data = FlatVector::GetData<hash_t>(hashes);
+
+	// find the first value with the same hash for every row
+	SelectionVector row_sel(approved_tuple_count);
+	vector<idx_t> positions(approved_tuple_count);
+	idx_t candidate_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		const auto idx = sel.get_index(i);
+		if (!vdata.validity.RowIsValid(vdata.sel->get_index(idx))) {
+			continue;
+		}
+		const auto hash = hash_data[idx];
+		auto entry = std::lower_bound(value_hashes.begin(), value_hashes.end(), make_pair(hash, idx_t(0)));
+		if (entry == value_hashes.end() || entry->first != hash) {
+			continue;
+		}
+		row_sel.set_index(candidate_count, idx);
+		positions[candidate_count] = NumericCast<idx_t>(entry - value_hashes.begin());
+		candidate_count++;
+	}
+
+	// now compare the candidates with the values they hashed to
+	SelectionVector result_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	idx_t round_count = 0;
+	SelectionVector value_sel(candidate_count);
+	SelectionVector match_sel(candidate_count);
+	SelectionVector no_match_sel(candidate_count);
+	while (candidate_count > 0) {
+		round_count++;
+		for (idx_t i = 0; i < candidate_count; i++) {
+			value_sel.set_index(i, value_hashes[positions[i]].second);
+		}
+		Vector row_vector(input, row_sel, candidate_count);
+		Vector value_vector(*values_vector, value_sel, candidate_count);
+		const auto match_count =
+		    VectorOperations::Equals(row_vector, value_vector, nullptr, candidate_count, &match_sel, &no_match_sel);
+		for (idx_t i = 0; i < match_count; i++) {
+			result_sel.set_index(result_count++, row_sel.get_index(match_sel.get_index(i)));
+		}
+		// in the (unlikely) case of a hash collision, the row can still be equal to the next value with the same hash
+		idx_t retry_count = 0;
+		for (idx_t i = 0; i < candidate_count - match_count; i++) {
+			const auto candidate_idx = no_match_sel.get_index(i);
+			const auto position = positions[candidate_idx];
+			const auto next_position = position + 1;
+			if (next_position == value_hashes.size() ||
+			    value_hashes[next_position].first != value_hashes[position].first) {
+				continue;
+			}
+			row_sel.set_index(retry_count, row_sel.get_index(candidate_idx));
+			positions[retry_count] = next_position;
+			retry_count++;
+		}
+		candidate_count = retry_count;
+	}
+	if (round_count > 1) {
+		// keep the selection in the original order of the rows
+		std::sort(result_sel.data(), result_sel.data() + result_count);
+	}
+	sel.Initialize(result_sel);
+	approved_tuple_count = result_count;
+	return result_count;
+}
+
+FilterPropagateResult InFilter::CheckStatistics(BaseStatistics &stats) {
+	if (values[0].type().id() != stats.GetType().id()) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	// the filter is true if the row is equal to ANY of the values
+	for (auto &value : values) {
+		FilterPropagateResult prune_result;
+		switch (value.type().InternalType()) {
+		case PhysicalType::UINT8:
+		case PhysicalType::UINT16:
+		case PhysicalType::UINT32:
+		case PhysicalType::UINT64:
+		case PhysicalType::UINT128:
+		case PhysicalType::INT8:
+		case PhysicalType::INT16:
+		case PhysicalType::INT32:
+		case PhysicalType::INT64:
+		case PhysicalType::INT128:
+		case PhysicalType::FLOAT:
+		case PhysicalType::DOUBLE:
+			prune_result = NumericStats::CheckZonemap(stats, ExpressionType::COMPARE_EQUAL, value);
+			break;
+		case PhysicalType::VARCHAR:
+			prune_result = StringStats::CheckZonemap(stats, ExpressionType::COMPARE_EQUAL, StringValue::Get(value));
+			break;
+		default:
+			return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+		if (prune_result != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+			return prune_result;
+		}
+	}
+	return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+}
+
+string InFilter::ToString(const string &column_name) {
+	string in_list;
+	for (idx_t i = 0; i < values.size(); i++) {
+		if (i > 0) {
+			in_list += ", ";
+		}
+		in_list += values[i].ToSQLString();
+	}
+	return column_name + " IN (" + in_list + ")";
+}
+
+unique_ptr<Expression> InFilter::ToExpression(const Expression &column) const {
+	auto result = make_uniq<BoundOperatorExpression>(ExpressionType::COMPARE_IN, LogicalType::BOOLEAN);
+	result->children.push_back(column.Copy());
+	for (auto &value : values) {
+		result->children.push_back(make_uniq<BoundConstantExpression>(value));
+	}
+	return std::move(result);
+}
+
+bool InFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<InFilter>();
+	return other.values == values;
+}
+
+unique_ptr<TableFilter> InFilter::Copy() const {
+	return make_uniq<InFilter>(values);
+}
+
+} // namespace duckdb
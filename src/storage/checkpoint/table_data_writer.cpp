@@ -26,6 +26,14 @@ CompressionType TableDataWriter::GetColumnCompressionType(idx_t i) {
 	return table.GetColumn(LogicalIndex(i)).CompressionType();
 }
 
+vector<PhysicalIndex> TableDataWriter::GetSortColumns() {
+	vector<PhysicalIndex> result;
+	for (auto &sort_key : table.GetSortKeys()) {
+		result.push_back(table.GetColumn(sort_key).Physical());
+	}
+	return result;
+}
+
 void TableDataWriter::AddRowGroup(RowGroupPointer &&row_group_pointer, unique_ptr<RowGroupWriter> writer) {
 	row_group_pointers.push_back(std::move(row_group_pointer));
 }
@@ -107,6 +107,8 @@ struct DictionaryCompressionStorage {
 	static void StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
 	                              idx_t result_offset);
 	static void StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result);
+	static void StringFilter(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+	                         SelectionVector &sel, idx_t &approved_tuple_count, const TableFilter &filter);
 	static void StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
 	                           idx_t result_idx);
 
@@ -441,9 +443,13 @@ void DictionaryCompressionStorage::FinalizeCompress(CompressionState &state_p) {
 struct CompressedStringScanState : public StringScanState {
 	BufferHandle handle;
 	buffer_ptr<Vector> dictionary;
+	idx_t dictionary_size;
 	bitpacking_width_t current_width;
 	buffer_ptr<SelectionVector> sel_vec;
 	idx_t sel_vec_size = 0;
+	//! The filter that was evaluated on the dictionary (if any), and whether the strings in the dictionary passed it
+	optional_ptr<const TableFilter> filter;
+	vector<bool> filter_matches;
 };
 
 unique_ptr<SegmentScanState> DictionaryCompressionStorage::StringInitScan(ColumnSegment &segment) {
@@ -463,6 +469,7 @@ unique_ptr<SegmentScanState> DictionaryCompressionStorage::StringInitScan(Column
 	auto index_buffer_ptr = reinterpret_cast<uint32_t *>(baseptr + index_buffer_offset);
 
 	state->dictionary = make_buffer<Vector>(segment.type, index_buffer_count);
+	state->dictionary_size = index_buffer_count;
 	auto dict_child_data = FlatVector::GetData<string_t>(*(state->dictionary));
 
 	for (uint32_t i = 0; i < index_buffer_count; i++) {
@@ -554,6 +561,68 @@ void DictionaryCompressionStorage::StringScan(ColumnSegment &segment, ColumnScan
 	StringScanPartial<true>(segment, state, scan_count, result, 0);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+void DictionaryCompressionStorage::StringFilter(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count,
+                                                Vector &result, SelectionVector &sel, idx_t &approved_tuple_count,
+                                                const TableFilter &filter) {
+	auto &scan_state = state.scan_state->Cast<CompressedStringScanState>();
+	if (scan_state.filter.get() != &filter) {
+		// evaluate the filter once for every string in the dictionary, and keep the result for the following vectors
+		auto &dictionary = *scan_state.dictionary;
+		SelectionVector dictionary_sel;
+		idx_t match_count = scan_state.dictionary_size;
+		UnifiedVectorFormat dictionary_format;
+		dictionary.ToUnifiedFormat(scan_state.dictionary_size, dictionary_format);
+		ColumnSegment::FilterSelection(dictionary_sel, dictionary, dictionary_format, filter,
+		                               scan_state.dictionary_size, match_count);
+		scan_state.filter_matches.assign(scan_state.dictionary_size, false);
+		for (idx_t i = 0; i < match_count; i++) {
+			scan_state.filter_matches[dictionary_sel.get_index(i)] = true;
+		}
+		scan_state.filter = &filter;
+	}
+
+	// unpack the dictionary indices of the vector
+	auto start = segment.GetRelativeIndex(state.row_index);
+	auto baseptr = scan_state.handle.Ptr() + segment.GetBlockOffset();
+	auto base_data = data_ptr_cast(baseptr + DICTIONARY_HEADER_SIZE);
+	idx_t start_offset = start % BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE;
+	idx_t decompress_count = BitpackingPrimitives::RoundUpToAlgorithmGroupSize(scan_count + start_offset);
+	if (!scan_state.sel_vec || scan_state.sel_vec_size < decompress_count) {
+		scan_state.sel_vec_size = decompress_count;
+		scan_state.sel_vec = make_buffer<SelectionVector>(decompress_count);
+	}
+	data_ptr_t src = &base_data[((start - start_offset) * scan_state.current_width) / 8];
+	BitpackingPrimitives::UnPackBuffer<sel_t>(data_ptr_cast(scan_state.sel_vec->data()), src, decompress_count,
+	                                          scan_state.current_width);
+
+	// select the rows of which the string passed the filter
+	SelectionVector result_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		if (scan_state.filter_matches[scan_state.sel_vec->get_index(start_offset + idx)]) {
+			result_sel.set_index(result_count++, idx);
+		}
+	}
+	if (result_count < approved_tuple_count) {
+		sel.Initialize(result_sel);
+		approved_tuple_count = result_count;
+	}
+	if (approved_tuple_count == 0) {
+		// no row passes the filter: the strings do not have to be fetched
+		return;
+	}
+	if (start_offset == 0 && scan_count == STANDARD_VECTOR_SIZE) {
+		// the indices are already unpacked: emit a dictionary vector
+		result.Slice(*scan_state.dictionary, *scan_state.sel_vec, scan_count);
+	} else {
+		StringScanPartial<false>(segment, state, scan_count, result, 0);
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -651,13 +720,15 @@ uint16_t DictionaryCompressionStorage::GetStringLength(uint32_t *index_buffer_pt
 // Get Function
 //===--------------------------------------------------------------------===//
 CompressionFunction DictionaryCompressionFun::GetFunction(PhysicalType data_type) {
-	return CompressionFunction(
+	CompressionFunction result(
 	    CompressionType::COMPRESSION_DICTIONARY, data_type, DictionaryCompressionStorage ::StringInitAnalyze,
 	    DictionaryCompressionStorage::StringAnalyze, DictionaryCompressionStorage::StringFinalAnalyze,
 	    DictionaryCompressionStorage::InitCompression, DictionaryCompressionStorage::Compress,
 	    DictionaryCompressionStorage::FinalizeCompress, DictionaryCompressionStorage::StringInitScan,
 	    DictionaryCompressionStorage::StringScan, DictionaryCompressionStorage::StringScanPartial<false>,
 	    DictionaryCompressionStorage::StringFetchRow, UncompressedFunctions::EmptySkip);
+	result.filter = DictionaryCompressionStorage::StringFilter;
+	return result;
 }
 
 bool DictionaryCompressionFun::TypeIsSupported(const PhysicalType physical_type) {
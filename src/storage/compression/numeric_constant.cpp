@@ -74,6 +74,24 @@ void ConstantScanFunction(ColumnSegment &segment, ColumnScanState &state, idx_t
 	result.SetVectorType(VectorType::CONSTANT_VECTOR);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+template <class T>
+void ConstantFilterFunction(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                            SelectionVector &sel, idx_t &approved_tuple_count, const TableFilter &filter) {
+	ConstantScanFunction<T>(segment, state, scan_count, result);
+	// all rows have the same value: the filter only has to be evaluated once
+	SelectionVector constant_sel;
+	idx_t match_count = 1;
+	UnifiedVectorFormat constant_format;
+	result.ToUnifiedFormat(1, constant_format);
+	ColumnSegment::FilterSelection(constant_sel, result, constant_format, filter, 1, match_count);
+	if (match_count == 0) {
+		approved_tuple_count = 0;
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -99,9 +117,11 @@ CompressionFunction ConstantGetFunctionValidity(PhysicalType data_type) {
 
 template <class T>
 CompressionFunction ConstantGetFunction(PhysicalType data_type) {
-	return CompressionFunction(CompressionType::COMPRESSION_CONSTANT, data_type, nullptr, nullptr, nullptr, nullptr,
+	CompressionFunction result(CompressionType::COMPRESSION_CONSTANT, data_type, nullptr, nullptr, nullptr, nullptr,
 	                           nullptr, nullptr, ConstantInitScan, ConstantScanFunction<T>, ConstantScanPartial<T>,
 	                           ConstantFetchRow<T>, UncompressedFunctions::EmptySkip);
+	result.filter = ConstantFilterFunction<T>;
+	return result;
 }
 
 CompressionFunction ConstantFun::GetFunction(PhysicalType data_type) {
@@ -377,6 +377,66 @@ void RLEScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, V
 	RLEScanPartialInternal<T, true>(segment, state, scan_count, result, 0);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+template <class T>
+void RLEFilter(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result, SelectionVector &sel,
+               idx_t &approved_tuple_count, const TableFilter &filter) {
+	auto &scan_state = state.scan_state->Cast<RLEScanState<T>>();
+
+	auto data = scan_state.handle.Ptr() + segment.GetBlockOffset();
+	auto data_pointer = reinterpret_cast<T *>(data + RLEConstants::RLE_HEADER_SIZE);
+	auto index_pointer = reinterpret_cast<rle_count_t *>(data + scan_state.rle_count_offset);
+
+	// collect the values of the runs in this vector, and where they end
+	Vector run_values(result.GetType(), scan_count);
+	auto run_data = FlatVector::GetData<T>(run_values);
+	vector<idx_t> run_ends;
+	auto entry_pos = scan_state.entry_pos;
+	auto position_in_entry = scan_state.position_in_entry;
+	for (idx_t row_idx = 0; row_idx < scan_count; entry_pos++) {
+		run_data[run_ends.size()] = data_pointer[entry_pos];
+		row_idx += MinValue<idx_t>(index_pointer[entry_pos] - position_in_entry, scan_count - row_idx);
+		run_ends.push_back(row_idx);
+		position_in_entry = 0;
+	}
+
+	// evaluate the filter once per run
+	auto run_count = run_ends.size();
+	SelectionVector run_sel;
+	idx_t run_match_count = run_count;
+	UnifiedVectorFormat run_format;
+	run_values.ToUnifiedFormat(run_count, run_format);
+	ColumnSegment::FilterSelection(run_sel, run_values, run_format, filter, run_count, run_match_count);
+
+	if (run_match_count == 0) {
+		// no row passes the filter: skip the vector without decompressing it
+		approved_tuple_count = 0;
+		scan_state.Skip(segment, scan_count);
+		return;
+	}
+	if (run_match_count < run_count) {
+		// select the rows of the runs that passed the filter
+		vector<bool> run_matches(run_count, false);
+		for (idx_t i = 0; i < run_match_count; i++) {
+			run_matches[run_sel.get_index(i)] = true;
+		}
+		SelectionVector result_sel(approved_tuple_count);
+		idx_t result_count = 0;
+		for (idx_t i = 0; i < approved_tuple_count; i++) {
+			auto idx = sel.get_index(i);
+			auto run_end = std::upper_bound(run_ends.begin(), run_ends.end(), idx);
+			if (run_matches[NumericCast<idx_t>(run_end - run_ends.begin())]) {
+				result_sel.set_index(result_count++, idx);
+			}
+		}
+		sel.Initialize(result_sel);
+		approved_tuple_count = result_count;
+	}
+	RLEScan<T>(segment, state, scan_count, result);
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -396,10 +456,15 @@ void RLEFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id,
 //===--------------------------------------------------------------------===//
 template <class T, bool WRITE_STATISTICS = true>
 CompressionFunction GetRLEFunction(PhysicalType data_type) {
-	return CompressionFunction(CompressionType::COMPRESSION_RLE, data_type, RLEInitAnalyze<T>, RLEAnalyze<T>,
+	CompressionFunction result(CompressionType::COMPRESSION_RLE, data_type, RLEInitAnalyze<T>, RLEAnalyze<T>,
 	                           RLEFinalAnalyze<T>, RLEInitCompression<T, WRITE_STATISTICS>,
 	                           RLECompress<T, WRITE_STATISTICS>, RLEFinalizeCompress<T, WRITE_STATISTICS>,
 	                           RLEInitScan<T>, RLEScan<T>, RLEScanPartial<T>, RLEFetchRow<T>, RLESkip<T>);
+	if (WRITE_STATISTICS) {
+		// the list offsets (without statistics) are never filtered
+		result.filter = RLEFilter<T>;
+	}
+	return result;
 }
 
 CompressionFunction RLEFun::GetFunction(PhysicalType type) {
@@ -266,6 +266,7 @@ void ValidityScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t s
 	while (pos < scan_count) {
 		// these are the current validity entries we are dealing with
 		idx_t current_result_idx = result_entry;
+		idx_t current_result_start = result_idx;
 		idx_t offset;
 		validity_t input_mask = input_data[input_entry];
 
@@ -313,13 +314,18 @@ void ValidityScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t s
 			result_entry++;
 			result_idx = input_idx = 0;
 		}
+		// the bits before the start of the scan in the result entry are not part of the scan either
+		// (these are only set if we scan into the middle of the result from the middle of the input)
+		input_mask |= ValidityUncompressed::LOWER_MASKS[current_result_start];
 		// now we need to check if we should include the ENTIRE mask
 		// OR if we need to mask from the right side
 		pos += offset;
 		if (pos > scan_count) {
 			// we need to set any bits that are past the scan_count on the right-side to 1
 			// this is required so we don't influence any bits that are not part of the scan
-			input_mask |= ValidityUncompressed::UPPER_MASKS[pos - scan_count];
+			// note that if we shifted the input RIGHT, the bits we wrote end before the end of the result entry
+			auto unwritten_count = ValidityMask::BITS_PER_VALUE - (current_result_start + offset);
+			input_mask |= ValidityUncompressed::UPPER_MASKS[unwritten_count + pos - scan_count];
 		}
 		// now finally we can merge the input mask with the result mask
 		if (input_mask != ValidityMask::ValidityBuffer::MAX_ENTRY) {
@@ -0,0 +1,506 @@
+#include "duckdb/common/random_engine.hpp"
+#include "duckdb/common/types/vector_buffer.hpp"
+#include "duckdb/function/compression/compression.hpp"
+#include "duckdb/function/compression_function.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/string_uncompressed.hpp"
+#include "duckdb/storage/table/column_data_checkpointer.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
+
+#include "zstd.h"
+
+namespace duckdb {
+
+// A ZSTD segment consists of a header, followed by the compressed frames and a table with the location of each frame
+// | header | frame 0 | frame 1 | ... | frame table |
+// Each frame holds a range of consecutive rows: the lengths of the strings (uint32_t), followed by the string data
+// NULL values are stored as empty strings, the validity is stored separately
+typedef struct {
+	uint32_t frame_count;
+	uint32_t frame_table_offset;
+} zstd_compression_header_t;
+
+typedef struct {
+	//! The first row of the frame (relative to the start of the segment)
+	uint32_t row_start;
+	//! The offset of the compressed frame (relative to the start of the segment)
+	uint32_t offset;
+	uint32_t compressed_size;
+	uint32_t uncompressed_size;
+} zstd_frame_t;
+
+struct ZSTDStorage {
+	//! Decompressing a frame is more expensive than decoding a lightweight compression (e.g., FSST or dictionary)
+	//! so ZSTD is only chosen if it is significantly smaller
+	static constexpr double MINIMUM_COMPRESSION_RATIO = 2.0;
+	static constexpr double ANALYSIS_SAMPLE_SIZE = 0.25;
+	//! The maximum amount of rows in a frame
+	static constexpr idx_t FRAME_ROW_COUNT = STANDARD_VECTOR_SIZE;
+	static constexpr int COMPRESSION_LEVEL = ZSTD_CLEVEL_DEFAULT;
+
+	static unique_ptr<AnalyzeState> StringInitAnalyze(ColumnData &col_data, PhysicalType type);
+	static bool StringAnalyze(AnalyzeState &state_p, Vector &input, idx_t count);
+	static idx_t StringFinalAnalyze(AnalyzeState &state_p);
+
+	static unique_ptr<CompressionState> InitCompression(ColumnDataCheckpointer &checkpointer,
+	                                                    unique_ptr<AnalyzeState> analyze_state_p);
+	static void Compress(CompressionState &state_p, Vector &scan_vector, idx_t count);
+	static void FinalizeCompress(CompressionState &state_p);
+
+	static unique_ptr<SegmentScanState> StringInitScan(ColumnSegment &segment);
+	static void StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+	                              idx_t result_offset);
+	static void StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result);
+	static void StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+	                           idx_t result_idx);
+
+	//! The maximum amount of uncompressed bytes in a frame, and the largest string that can be stored
+	//! (this guarantees that a frame with a single string fits into a segment after compression)
+	static idx_t GetMaxFrameSize(idx_t block_size) {
+		return block_size / 2;
+	}
+	//! Compresses a frame into the buffer, and returns the compressed size
+	static idx_t CompressFrame(duckdb_zstd::ZSTD_CCtx *context, const_data_ptr_t frame, idx_t frame_size,
+	                           vector<data_t> &buffer);
+};
+
+idx_t ZSTDStorage::CompressFrame(duckdb_zstd::ZSTD_CCtx *context, const_data_ptr_t frame, idx_t frame_size,
+                                 vector<data_t> &buffer) {
+	buffer.resize(duckdb_zstd::ZSTD_compressBound(frame_size));
+	auto compressed_size =
+	    duckdb_zstd::ZSTD_compressCCtx(context, buffer.data(), buffer.size(), frame, frame_size, COMPRESSION_LEVEL);
+	if (duckdb_zstd::ZSTD_isError(compressed_size)) {
+		throw InternalException("ZSTD compression failed: %s", duckdb_zstd::ZSTD_getErrorName(compressed_size));
+	}
+	return compressed_size;
+}
+
+//===--------------------------------------------------------------------===//
+// Analyze
+//===--------------------------------------------------------------------===//
+struct ZSTDAnalyzeState : public AnalyzeState {
+	ZSTDAnalyzeState(const CompressionInfo &info, idx_t row_start)
+	    : AnalyzeState(info), random_engine(NumericCast<int64_t>(row_start)) {
+		context = duckdb_zstd::ZSTD_createCCtx();
+	}
+	~ZSTDAnalyzeState() override {
+		duckdb_zstd::ZSTD_freeCCtx(context);
+	}
+
+	duckdb_zstd::ZSTD_CCtx *context;
+	//! Selects the sampled vectors - it is seeded with the start of the column, so that the same data is always
+	//! sampled (and compressed) in the same way
+	RandomEngine random_engine;
+
+	//! The amount of rows, and the uncompressed size of all frames
+	idx_t count = 0;
+	idx_t total_size = 0;
+	//! The uncompressed and compressed size of the sampled frames
+	idx_t sample_size = 0;
+	idx_t sample_compressed_size = 0;
+	//! Whether there are any non-empty strings
+	bool have_data = false;
+
+	vector<data_t> frame;
+	vector<data_t> compress_buffer;
+};
+
+unique_ptr<AnalyzeState> ZSTDStorage::StringInitAnalyze(ColumnData &col_data, PhysicalType type) {
+	CompressionInfo info(col_data.GetBlockManager().GetBlockSize());
+	return make_uniq<ZSTDAnalyzeState>(info, col_data.start);
+}
+
+bool ZSTDStorage::StringAnalyze(AnalyzeState &state_p, Vector &input, idx_t count) {
+	auto &state = state_p.Cast<ZSTDAnalyzeState>();
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<string_t>(vdata);
+
+	// compress every vector until we have seen data, and a sample of the vectors after that
+	bool sample_selected = !state.have_data || state.random_engine.NextRandom() < ANALYSIS_SAMPLE_SIZE;
+	auto max_string_size = GetMaxFrameSize(state.info.GetBlockSize());
+
+	idx_t string_size = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			continue;
+		}
+		auto size = data[idx].GetSize();
+		if (size > max_string_size) {
+			return false;
+		}
+		string_size += size;
+	}
+	auto frame_size = count * sizeof(uint32_t) + string_size;
+	state.count += count;
+	state.total_size += frame_size;
+	if (!sample_selected) {
+		return true;
+	}
+	state.have_data = state.have_data || string_size > 0;
+
+	// compress the vector as a frame
+	state.frame.resize(frame_size);
+	auto lengths = state.frame.data();
+	auto string_data = lengths + count * sizeof(uint32_t);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		uint32_t size = 0;
+		if (vdata.validity.RowIsValid(idx)) {
+			size = UnsafeNumericCast<uint32_t>(data[idx].GetSize());
+			memcpy(string_data, data[idx].GetData(), size);
+			string_data += size;
+		}
+		Store<uint32_t>(size, lengths + i * sizeof(uint32_t));
+	}
+	state.sample_size += frame_size;
+	state.sample_compressed_size += CompressFrame(state.context, state.frame.data(), frame_size, state.compress_buffer);
+	return true;
+}
+
+idx_t ZSTDStorage::StringFinalAnalyze(AnalyzeState &state_p) {
+	auto &state = state_p.Cast<ZSTDAnalyzeState>();
+	if (!state.have_data || state.sample_size == 0) {
+		// only NULLs and empty strings: there is nothing to compress
+		return DConstants::INVALID_INDEX;
+	}
+	auto compression_ratio = double(state.sample_compressed_size) / double(state.sample_size);
+	auto estimated_data_size = double(state.total_size) * compression_ratio;
+	auto frame_count = double(state.count) / double(FRAME_ROW_COUNT);
+	auto segment_count = estimated_data_size / double(state.info.GetBlockSize());
+	auto estimated_size = estimated_data_size + frame_count * sizeof(zstd_frame_t) +
+	                      segment_count * sizeof(zstd_compression_header_t);
+	return LossyNumericCast<idx_t>(estimated_size * MINIMUM_COMPRESSION_RATIO);
+}
+
+//===--------------------------------------------------------------------===//
+// Compress
+//===--------------------------------------------------------------------===//
+class ZSTDCompressionState : public CompressionState {
+public:
+	ZSTDCompressionState(ColumnDataCheckpointer &checkpointer, const CompressionInfo &info)
+	    : CompressionState(info), checkpointer(checkpointer),
+	      function(checkpointer.GetCompressionFunction(CompressionType::COMPRESSION_ZSTD)) {
+		context = duckdb_zstd::ZSTD_createCCtx();
+		CreateEmptySegment(checkpointer.GetRowGroup().start);
+		string_offsets.push_back(0);
+	}
+	~ZSTDCompressionState() override {
+		duckdb_zstd::ZSTD_freeCCtx(context);
+	}
+
+	void CreateEmptySegment(idx_t row_start) {
+		auto &db = checkpointer.GetDatabase();
+		auto &type = checkpointer.GetType();
+		current_segment =
+		    ColumnSegment::CreateTransientSegment(db, type, row_start, info.GetBlockSize(), info.GetBlockSize());
+		current_segment->function = function;
+		auto &buffer_manager = BufferManager::GetBufferManager(db);
+		current_handle = buffer_manager.Pin(current_segment->block);
+		data_size = 0;
+		frames.clear();
+	}
+
+	void Append(string_t value, bool is_valid) {
+		lengths.push_back(is_valid ? UnsafeNumericCast<uint32_t>(value.GetSize()) : 0);
+		validity.push_back(is_valid);
+		if (is_valid) {
+			string_data.insert(string_data.end(), value.GetData(), value.GetData() + value.GetSize());
+		}
+		string_offsets.push_back(string_data.size());
+		auto frame_size = lengths.size() * sizeof(uint32_t) + string_data.size();
+		if (lengths.size() >= ZSTDStorage::FRAME_ROW_COUNT ||
+		    frame_size >= ZSTDStorage::GetMaxFrameSize(info.GetBlockSize())) {
+			FlushFrame();
+		}
+	}
+
+	//! Writes the buffered rows to the segment as one or more frames
+	void FlushFrame() {
+		if (!lengths.empty()) {
+			WriteFrame(0, lengths.size());
+		}
+		lengths.clear();
+		validity.clear();
+		string_data.clear();
+		string_offsets.clear();
+		string_offsets.push_back(0);
+	}
+
+	void WriteFrame(idx_t begin, idx_t end) {
+		auto row_count = end - begin;
+		auto string_size = string_offsets[end] - string_offsets[begin];
+		frame.resize(row_count * sizeof(uint32_t) + string_size);
+		memcpy(frame.data(), lengths.data() + begin, row_count * sizeof(uint32_t));
+		memcpy(frame.data() + row_count * sizeof(uint32_t), string_data.data() + string_offsets[begin], string_size);
+		auto compressed_size = ZSTDStorage::CompressFrame(context, frame.data(), frame.size(), compress_buffer);
+
+		while (!HasEnoughSpace(compressed_size)) {
+			if (current_segment->count > 0) {
+				// the segment is full: continue in a new segment
+				FlushSegment();
+				continue;
+			}
+			if (row_count > 1) {
+				// the frame does not fit into an empty segment: split it up
+				auto middle = begin + row_count / 2;
+				WriteFrame(begin, middle);
+				WriteFrame(middle, end);
+				return;
+			}
+			throw InternalException("ZSTD string compression failed due to insufficient space in empty block");
+		}
+
+		// write the frame, and update the statistics of the segment
+		auto offset = sizeof(zstd_compression_header_t) + data_size;
+		memcpy(current_handle.Ptr() + offset, compress_buffer.data(), compressed_size);
+		zstd_frame_t entry;
+		entry.row_start = UnsafeNumericCast<uint32_t>(current_segment->count.load());
+		entry.offset = UnsafeNumericCast<uint32_t>(offset);
+		entry.compressed_size = UnsafeNumericCast<uint32_t>(compressed_size);
+		entry.uncompressed_size = UnsafeNumericCast<uint32_t>(frame.size());
+		frames.push_back(entry);
+		data_size += compressed_size;
+		for (idx_t i = begin; i < end; i++) {
+			if (validity[i]) {
+				auto str = string_t(string_data.data() + string_offsets[i], lengths[i]);
+				UncompressedStringStorage::UpdateStringStats(current_segment->stats, str);
+			}
+		}
+		current_segment->count += row_count;
+	}
+
+	bool HasEnoughSpace(idx_t compressed_size) {
+		auto required_size = sizeof(zstd_compression_header_t) + data_size + compressed_size +
+		                     (frames.size() + 1) * sizeof(zstd_frame_t);
+		return required_size <= info.GetBlockSize();
+	}
+
+	void FlushSegment(bool final = false) {
+		auto next_start = current_segment->start + current_segment->count;
+
+		// write the frame table and the header
+		auto base_ptr = current_handle.Ptr();
+		auto frame_table_offset = sizeof(zstd_compression_header_t) + data_size;
+		auto frame_table_ptr = base_ptr + frame_table_offset;
+		for (auto &entry : frames) {
+			Store<uint32_t>(entry.row_start, frame_table_ptr);
+			Store<uint32_t>(entry.offset, frame_table_ptr + sizeof(uint32_t));
+			Store<uint32_t>(entry.compressed_size, frame_table_ptr + 2 * sizeof(uint32_t));
+			Store<uint32_t>(entry.uncompressed_size, frame_table_ptr + 3 * sizeof(uint32_t));
+			frame_table_ptr += sizeof(zstd_frame_t);
+		}
+		auto header_ptr = reinterpret_cast<zstd_compression_header_t *>(base_ptr);
+		Store<uint32_t>(UnsafeNumericCast<uint32_t>(frames.size()), data_ptr_cast(&header_ptr->frame_count));
+		Store<uint32_t>(UnsafeNumericCast<uint32_t>(frame_table_offset),
+		                data_ptr_cast(&header_ptr->frame_table_offset));
+		auto segment_size = frame_table_offset + frames.size() * sizeof(zstd_frame_t);
+
+		auto &state = checkpointer.GetCheckpointState();
+		state.FlushSegment(std::move(current_segment), segment_size);
+
+		if (!final) {
+			CreateEmptySegment(next_start);
+		}
+	}
+
+	void Finalize() {
+		FlushFrame();
+		FlushSegment(true);
+	}
+
+	ColumnDataCheckpointer &checkpointer;
+	CompressionFunction &function;
+	duckdb_zstd::ZSTD_CCtx *context;
+
+	// State regarding the current segment
+	unique_ptr<ColumnSegment> current_segment;
+	BufferHandle current_handle;
+	//! The size of the frames written to the segment
+	idx_t data_size;
+	vector<zstd_frame_t> frames;
+
+	// The rows that have not been written to a frame yet
+	vector<uint32_t> lengths;
+	vector<bool> validity;
+	vector<char> string_data;
+	vector<idx_t> string_offsets;
+
+	vector<data_t> frame;
+	vector<data_t> compress_buffer;
+};
+
+unique_ptr<CompressionState> ZSTDStorage::InitCompression(ColumnDataCheckpointer &checkpointer,
+                                                          unique_ptr<AnalyzeState> analyze_state_p) {
+	return make_uniq<ZSTDCompressionState>(checkpointer, analyze_state_p->info);
+}
+
+void ZSTDStorage::Compress(CompressionState &state_p, Vector &scan_vector, idx_t count) {
+	auto &state = state_p.Cast<ZSTDCompressionState>();
+	UnifiedVectorFormat vdata;
+	scan_vector.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<string_t>(vdata);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		state.Append(data[idx], vdata.validity.RowIsValid(idx));
+	}
+}
+
+void ZSTDStorage::FinalizeCompress(CompressionState &state_p) {
+	auto &state = state_p.Cast<ZSTDCompressionState>();
+	state.Finalize();
+}
+
+//===--------------------------------------------------------------------===//
+// Scan
+//===--------------------------------------------------------------------===//
+struct ZSTDScanState : public SegmentScanState {
+	explicit ZSTDScanState(ColumnSegment &segment) {
+		auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+		handle = buffer_manager.Pin(segment.block);
+		base_ptr = handle.Ptr() + segment.GetBlockOffset();
+		segment_count = segment.count;
+
+		auto header_ptr = reinterpret_cast<zstd_compression_header_t *>(base_ptr);
+		auto frame_count = Load<uint32_t>(data_ptr_cast(&header_ptr->frame_count));
+		auto frame_table_ptr = base_ptr + Load<uint32_t>(data_ptr_cast(&header_ptr->frame_table_offset));
+		frames.resize(frame_count);
+		for (auto &entry : frames) {
+			entry.row_start = Load<uint32_t>(frame_table_ptr);
+			entry.offset = Load<uint32_t>(frame_table_ptr + sizeof(uint32_t));
+			entry.compressed_size = Load<uint32_t>(frame_table_ptr + 2 * sizeof(uint32_t));
+			entry.uncompressed_size = Load<uint32_t>(frame_table_ptr + 3 * sizeof(uint32_t));
+			frame_table_ptr += sizeof(zstd_frame_t);
+		}
+		context = duckdb_zstd::ZSTD_createDCtx();
+	}
+	~ZSTDScanState() override {
+		duckdb_zstd::ZSTD_freeDCtx(context);
+	}
+
+	BufferHandle handle;
+	data_ptr_t base_ptr;
+	idx_t segment_count;
+	vector<zstd_frame_t> frames;
+	duckdb_zstd::ZSTD_DCtx *context;
+
+	//! The currently decompressed frame, which is referenced by the scanned vectors
+	idx_t current_frame = DConstants::INVALID_INDEX;
+	buffer_ptr<VectorBuffer> frame_buffer;
+	//! The offsets of the strings of the current frame in the frame buffer
+	vector<idx_t> string_offsets;
+
+public:
+	idx_t FrameEnd(idx_t frame_idx) const {
+		return frame_idx + 1 < frames.size() ? frames[frame_idx + 1].row_start : segment_count;
+	}
+
+	idx_t FindFrame(idx_t row) const {
+		if (current_frame != DConstants::INVALID_INDEX && row >= frames[current_frame].row_start) {
+			// scans are mostly sequential: check the current and the next frame first
+			if (row < FrameEnd(current_frame)) {
+				return current_frame;
+			}
+			if (current_frame + 1 < frames.size() && row < FrameEnd(current_frame + 1)) {
+				return current_frame + 1;
+			}
+		}
+		auto entry = std::upper_bound(frames.begin(), frames.end(), row, [](idx_t row, const zstd_frame_t &frame) {
+			return row < frame.row_start;
+		});
+		D_ASSERT(entry != frames.begin());
+		return NumericCast<idx_t>(entry - frames.begin()) - 1;
+	}
+
+	void LoadFrame(idx_t frame_idx) {
+		if (frame_idx == current_frame) {
+			return;
+		}
+		auto &entry = frames[frame_idx];
+		frame_buffer = make_buffer<VectorBuffer>(entry.uncompressed_size);
+		auto frame_data = frame_buffer->GetData();
+		auto decompressed_size = duckdb_zstd::ZSTD_decompressDCtx(context, frame_data, entry.uncompressed_size,
+		                                                           base_ptr + entry.offset, entry.compressed_size);
+		if (duckdb_zstd::ZSTD_isError(decompressed_size) || decompressed_size != entry.uncompressed_size) {
+			throw IOException("ZSTD decompression of a column segment failed");
+		}
+		auto row_count = FrameEnd(frame_idx) - entry.row_start;
+		string_offsets.resize(row_count);
+		idx_t string_offset = row_count * sizeof(uint32_t);
+		for (idx_t i = 0; i < row_count; i++) {
+			string_offsets[i] = string_offset;
+			string_offset += Load<uint32_t>(frame_data + i * sizeof(uint32_t));
+		}
+		current_frame = frame_idx;
+	}
+
+	void ScanRows(idx_t start, idx_t scan_count, Vector &result, idx_t result_offset) {
+		auto result_data = FlatVector::GetData<string_t>(result);
+		idx_t scanned = 0;
+		while (scanned < scan_count) {
+			auto row = start + scanned;
+			LoadFrame(FindFrame(row));
+			auto frame_start = frames[current_frame].row_start;
+			auto frame_data = frame_buffer->GetData();
+			auto count = MinValue<idx_t>(scan_count - scanned, FrameEnd(current_frame) - row);
+			for (idx_t i = 0; i < count; i++) {
+				auto frame_row = row + i - frame_start;
+				auto length = Load<uint32_t>(frame_data + frame_row * sizeof(uint32_t));
+				auto str_ptr = const_char_ptr_cast(frame_data + string_offsets[frame_row]);
+				result_data[result_offset + scanned + i] = string_t(str_ptr, length);
+			}
+			// the strings point into the frame buffer: the result has to keep it alive
+			StringVector::AddBuffer(result, frame_buffer);
+			scanned += count;
+		}
+	}
+};
+
+unique_ptr<SegmentScanState> ZSTDStorage::StringInitScan(ColumnSegment &segment) {
+	return make_uniq<ZSTDScanState>(segment);
+}
+
+void ZSTDStorage::StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                                    idx_t result_offset) {
+	auto &scan_state = state.scan_state->Cast<ZSTDScanState>();
+	auto start = segment.GetRelativeIndex(state.row_index);
+	scan_state.ScanRows(start, scan_count, result, result_offset);
+}
+
+void ZSTDStorage::StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
+	StringScanPartial(segment, state, scan_count, result, 0);
+}
+
+//===--------------------------------------------------------------------===//
+// Fetch
+//===--------------------------------------------------------------------===//
+void ZSTDStorage::StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+                                 idx_t result_idx) {
+	// the scan state of the segment is kept in the fetch state: fetching rows from the same frame (e.g., in an index
+	// scan) decompresses the frame only once
+	auto &segment_state = state.segment_states[make_pair(segment.block->BlockId(), segment.GetBlockOffset())];
+	if (!segment_state) {
+		segment_state = make_uniq<ZSTDScanState>(segment);
+	}
+	auto &scan_state = segment_state->Cast<ZSTDScanState>();
+	scan_state.ScanRows(UnsafeNumericCast<idx_t>(row_id), 1, result, result_idx);
+}
+
+//===--------------------------------------------------------------------===//
+// Get Function
+//===--------------------------------------------------------------------===//
+CompressionFunction ZSTDFun::GetFunction(PhysicalType data_type) {
+	D_ASSERT(data_type == PhysicalType::VARCHAR);
+	return CompressionFunction(
+	    CompressionType::COMPRESSION_ZSTD, data_type, ZSTDStorage::StringInitAnalyze, ZSTDStorage::StringAnalyze,
+	    ZSTDStorage::StringFinalAnalyze, ZSTDStorage::InitCompression, ZSTDStorage::Compress,
+	    ZSTDStorage::FinalizeCompress, ZSTDStorage::StringInitScan, ZSTDStorage::StringScan,
+	    ZSTDStorage::StringScanPartial, ZSTDStorage::StringFetchRow, UncompressedFunctions::EmptySkip);
+}
+
+bool ZSTDFun::TypeIsSupported(const PhysicalType physical_type) {
+	return physical_type == PhysicalType::VARCHAR;
+}
+
+} // namespace duckdb
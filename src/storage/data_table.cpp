@@ -7,15 +7,18 @@
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/constraints/list.hpp"
 #include "duckdb/planner/constraints/list.hpp"
 #include "duckdb/planner/expression_binder/check_binder.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/checkpoint/table_data_writer.hpp"
 #include "duckdb/storage/storage_manager.hpp"
+#include "duckdb/storage/table_io_manager.hpp"
 #include "duckdb/storage/table_storage_info.hpp"
 #include "duckdb/storage/table/persistent_table_data.hpp"
 #include "duckdb/storage/table/row_group.hpp"
+#include "duckdb/storage/table/row_group_prefetcher.hpp"
 #include "duckdb/storage/table/standard_column_data.hpp"
 #include "duckdb/transaction/duck_transaction.hpp"
 #include "duckdb/transaction/transaction_manager.hpp"
@@ -32,7 +35,8 @@ namespace duckdb {
 
 DataTableInfo::DataTableInfo(AttachedDatabase &db, shared_ptr<TableIOManager> table_io_manager_p, string schema,
                              string table)
-    : db(db), table_io_manager(std::move(table_io_manager_p)), schema(std::move(schema)), table(std::move(table)) {
+    : db(db), table_io_manager(std::move(table_io_manager_p)), schema(std::move(schema)), table(std::move(table)),
+      last_commit_id(0), reorder_requested(false) {
 }
 
 void DataTableInfo::InitializeIndexes(ClientContext &context, const char *index_type) {
@@ -264,6 +268,15 @@ void DataTable::InitializeParallelScan(ClientContext &context, ParallelTableScan
 	state.checkpoint_lock = transaction.SharedLockTable(*info);
 	row_groups->InitializeParallelScan(state.scan_state);
 
+	auto prefetch_row_groups = DBConfig::GetConfig(context).options.scan_prefetch_row_groups;
+	auto &block_manager = TableIOManager::Get(*this).GetBlockManagerForRowData();
+	auto &scheduler = TaskScheduler::GetScheduler(context);
+	if (prefetch_row_groups > 0 && scheduler.NumberOfBackgroundThreads() > 0 && !block_manager.InMemory()) {
+		// read the blocks of upcoming row groups on the background threads
+		state.scan_state.prefetcher =
+		    make_uniq<RowGroupPrefetcher>(block_manager.buffer_manager, scheduler, prefetch_row_groups);
+	}
+
 	local_storage.InitializeParallelScan(*this, state.local_state);
 }
 
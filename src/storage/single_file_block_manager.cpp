@@ -39,12 +39,13 @@ void MainHeader::Write(WriteStream &ser) {
 	SerializeVersionNumber(ser, DuckDB::SourceID());
 }
 
-void MainHeader::CheckMagicBytes(FileHandle &handle) {
-	data_t magic_bytes[MAGIC_BYTE_SIZE];
-	if (handle.GetFileSize() < MainHeader::MAGIC_BYTE_SIZE + MainHeader::MAGIC_BYTE_OFFSET) {
+void MainHeader::CheckMagicBytes(FileHandle &handle, FileBuffer &buffer) {
+	// we read an entire sector into an aligned buffer, so that this also works for files opened with DIRECT_IO
+	if (handle.GetFileSize() < buffer.AllocSize()) {
 		throw IOException("The file \"%s\" exists, but it is not a valid DuckDB database file!", handle.path);
 	}
-	handle.Read(magic_bytes, MainHeader::MAGIC_BYTE_SIZE, MainHeader::MAGIC_BYTE_OFFSET);
+	buffer.Read(handle, 0);
+	auto magic_bytes = buffer.InternalBuffer() + MainHeader::MAGIC_BYTE_OFFSET;
 	if (memcmp(magic_bytes, MainHeader::MAGIC_BYTES, MainHeader::MAGIC_BYTE_SIZE) != 0) {
 		throw IOException("The file \"%s\" exists, but it is not a valid DuckDB database file!", handle.path);
 	}
@@ -232,7 +233,7 @@ void SingleFileBlockManager::LoadExistingDatabase() {
 		throw IOException("Cannot open database \"%s\" in read-only mode: database does not exist", path);
 	}
 
-	MainHeader::CheckMagicBytes(*handle);
+	MainHeader::CheckMagicBytes(*handle, header_buffer);
 	// otherwise, we check the metadata of the file
 	ReadAndChecksum(header_buffer, 0);
 	DeserializeHeaderStructure<MainHeader>(header_buffer.buffer);
@@ -671,11 +672,9 @@ void SingleFileBlockManager::WriteHeader(DatabaseHeader header) {
 		throw FatalException("Checkpoint aborted after free list write because of PRAGMA checkpoint_abort flag");
 	}
 
-	if (!options.use_direct_io) {
-		// if we are not using Direct IO we need to fsync BEFORE we write the header to ensure that all the previous
-		// blocks are written as well
-		handle->Sync();
-	}
+	// we need to fsync BEFORE we write the header to ensure that all the previous blocks are written as well
+	// this is also required with Direct IO, which bypasses the page cache but not the cache of the device
+	handle->Sync();
 	// set the header inside the buffer
 	header_buffer.Clear();
 	MemoryStream serializer;
@@ -20,7 +20,7 @@
 namespace duckdb {
 
 StorageManager::StorageManager(AttachedDatabase &db, string path_p, bool read_only)
-    : db(db), path(std::move(path_p)), read_only(read_only) {
+    : db(db), path(std::move(path_p)), read_only(read_only), checkpoint_requested(false) {
 
 	if (path.empty()) {
 		path = IN_MEMORY_PATH;
@@ -251,6 +251,8 @@ public:
 	void RevertCommit() override;
 	// Make the commit persistent
 	void FlushCommit() override;
+	bool RequiresSync() override;
+	void SyncCommit() override;
 
 	void AddRowGroupData(DataTable &table, idx_t start_index, idx_t count,
 	                     unique_ptr<PersistentCollectionData> row_group_data) override;
@@ -260,13 +262,16 @@ public:
 private:
 	idx_t initial_wal_size = 0;
 	idx_t initial_written = 0;
+	DBConfig &config;
 	WriteAheadLog &wal;
 	WALCommitState state;
+	//! The flush of the WAL that still has to be synced (if the sync was deferred)
+	optional_idx unsynced_flush;
 	reference_map_t<DataTable, unordered_map<idx_t, OptimisticallyWrittenRowGroupData>> optimistically_written_data;
 };
 
 SingleFileStorageCommitState::SingleFileStorageCommitState(StorageManager &storage, WriteAheadLog &wal)
-    : wal(wal), state(WALCommitState::IN_PROGRESS) {
+    : config(DBConfig::Get(storage.GetAttached())), wal(wal), state(WALCommitState::IN_PROGRESS) {
 	auto initial_size = storage.GetWALSize();
 	initial_written = wal.GetTotalWritten();
 	initial_wal_size = initial_size;
@@ -298,10 +303,28 @@ void SingleFileStorageCommitState::FlushCommit() {
 	if (state != WALCommitState::IN_PROGRESS) {
 		return;
 	}
-	wal.Flush();
+	if (config.options.wal_group_commit) {
+		// the WAL is synced by SyncCommit - outside of the transaction lock, together with concurrent commits
+		unsynced_flush = wal.FlushWithoutSync();
+	} else {
+		wal.Flush();
+	}
 	state = WALCommitState::FLUSHED;
 }
 
+bool SingleFileStorageCommitState::RequiresSync() {
+	return unsynced_flush.IsValid();
+}
+
+void SingleFileStorageCommitState::SyncCommit() {
+	if (!unsynced_flush.IsValid()) {
+		return;
+	}
+	auto flush_id = unsynced_flush.GetIndex();
+	unsynced_flush = optional_idx();
+	wal.SyncFlush(flush_id, config.options.wal_group_commit_delay);
+}
+
 void SingleFileStorageCommitState::AddRowGroupData(DataTable &table, idx_t start_index, idx_t count,
                                                    unique_ptr<PersistentCollectionData> row_group_data) {
 	if (row_group_data->HasUpdates()) {
@@ -358,9 +381,11 @@ void SingleFileStorageManager::CreateCheckpoint(CheckpointOptions options) {
 		db.GetStorageExtension()->OnCheckpointStart(db, options);
 	}
 	auto &config = DBConfig::Get(db);
-	if (GetWALSize() > 0 || config.options.force_checkpoint || options.action == CheckpointAction::ALWAYS_CHECKPOINT) {
-		// we only need to checkpoint if there is anything in the WAL
+	if (GetWALSize() > 0 || config.options.force_checkpoint || checkpoint_requested ||
+	    options.action == CheckpointAction::ALWAYS_CHECKPOINT) {
+		// we only need to checkpoint if there is anything in the WAL, or if a checkpoint was explicitly requested
 		try {
+			checkpoint_requested = false;
 			SingleFileCheckpointWriter checkpointer(db, *block_manager, options.type);
 			checkpointer.CreateCheckpoint();
 		} catch (std::exception &ex) {
@@ -1,8 +1,12 @@
 #include "duckdb/storage/table/column_data.hpp"
 #include "duckdb/common/exception/transaction_exception.hpp"
+#include "duckdb/common/types/bloom_filter.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/function/compression_function.hpp"
 #include "duckdb/planner/table_filter.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/storage/data_pointer.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/statistics/distinct_statistics.hpp"
@@ -136,10 +140,7 @@ void ColumnData::InitializePrefetch(PrefetchState &prefetch_state, ColumnScanSta
 	}
 }
 
-idx_t ColumnData::ScanVector(ColumnScanState &state, Vector &result, idx_t remaining, ScanVectorType scan_type) {
-	if (scan_type == ScanVectorType::SCAN_FLAT_VECTOR && result.GetVectorType() != VectorType::FLAT_VECTOR) {
-		throw InternalException("ScanVector called with SCAN_FLAT_VECTOR but result is not a flat vector");
-	}
+void ColumnData::BeginScanVector(ColumnScanState &state) {
 	state.previous_states.clear();
 	if (!state.initialized) {
 		D_ASSERT(state.current);
@@ -153,6 +154,13 @@ idx_t ColumnData::ScanVector(ColumnScanState &state, Vector &result, idx_t remai
 		state.current->Skip(state);
 	}
 	D_ASSERT(state.current->type == type);
+}
+
+idx_t ColumnData::ScanVector(ColumnScanState &state, Vector &result, idx_t remaining, ScanVectorType scan_type) {
+	if (scan_type == ScanVectorType::SCAN_FLAT_VECTOR && result.GetVectorType() != VectorType::FLAT_VECTOR) {
+		throw InternalException("ScanVector called with SCAN_FLAT_VECTOR but result is not a flat vector");
+	}
+	BeginScanVector(state);
 	idx_t initial_remaining = remaining;
 	while (remaining > 0) {
 		D_ASSERT(state.row_index >= state.current->start &&
@@ -223,6 +231,7 @@ void ColumnData::FetchUpdateRow(TransactionData transaction, row_t row_id, Vecto
 
 void ColumnData::UpdateInternal(TransactionData transaction, idx_t column_index, Vector &update_vector, row_t *row_ids,
                                 idx_t update_count, Vector &base_vector) {
+	ClearBloomFilter();
 	lock_guard<mutex> update_guard(update_lock);
 	if (!updates) {
 		updates = make_uniq<UpdateSegment>(*this);
@@ -310,6 +319,75 @@ void ColumnData::Select(TransactionData transaction, idx_t vector_index, ColumnS
 	ColumnSegment::FilterSelection(sel, result, vdata, filter, scan_count, s_count);
 }
 
+void ColumnData::MoveScanToRow(ColumnScanState &state, idx_t row_index, bool include_end) {
+	while (row_index > state.current->start + state.current->count ||
+	       (!include_end && row_index == state.current->start + state.current->count)) {
+		auto next = data.GetNextSegment(state.current);
+		D_ASSERT(next);
+		// the result can refer to the buffers of the previous segments
+		state.previous_states.emplace_back(std::move(state.scan_state));
+		state.current = next;
+		state.current->InitializeScan(state);
+		state.internal_index = state.current->start;
+		state.segment_checked = false;
+	}
+	state.row_index = row_index;
+}
+
+void ColumnData::ScanVectorSelection(ColumnScanState &state, Vector &result, idx_t target_count,
+                                     const SelectionVector &sel, idx_t sel_count) {
+	BeginScanVector(state);
+	const auto vector_start = state.row_index;
+	idx_t result_offset = 0;
+	while (result_offset < sel_count) {
+		// find the next run of consecutive selected rows
+		const auto run_start = sel.get_index(result_offset);
+		idx_t run_count = 1;
+		while (result_offset + run_count < sel_count &&
+		       sel.get_index(result_offset + run_count) == run_start + run_count) {
+			run_count++;
+		}
+		D_ASSERT(vector_start + run_start >= state.row_index);
+		MoveScanToRow(state, vector_start + run_start, false);
+		while (run_count > 0) {
+			if (state.internal_index < state.row_index) {
+				state.current->Skip(state);
+			}
+			auto scan_count = MinValue<idx_t>(run_count, state.current->start + state.current->count - state.row_index);
+			state.current->Scan(state, scan_count, result, result_offset, ScanVectorType::SCAN_FLAT_VECTOR);
+			state.row_index += scan_count;
+			state.internal_index = state.row_index;
+			result_offset += scan_count;
+			run_count -= scan_count;
+			if (run_count > 0) {
+				MoveScanToRow(state, state.row_index, false);
+			}
+		}
+	}
+	// the rows between the selected rows (and after them) are skipped by the next scan
+	MoveScanToRow(state, vector_start + target_count, true);
+}
+
+bool ColumnData::CanFilterVector(ColumnScanState &state, idx_t scan_count, Vector &result, const TableFilter &filter) {
+	if (!state.current || (state.scan_options && state.scan_options->force_fetch_row)) {
+		return false;
+	}
+	if (result.GetVectorType() != VectorType::FLAT_VECTOR || !state.current->CanFilter(filter)) {
+		return false;
+	}
+	// the vector has to be stored in the current segment, without any updates
+	return GetVectorScanType(state, scan_count, result) == ScanVectorType::SCAN_ENTIRE_VECTOR;
+}
+
+void ColumnData::FilterVector(ColumnScanState &state, idx_t scan_count, Vector &result, SelectionVector &sel,
+                              idx_t &approved_tuple_count, const TableFilter &filter) {
+	BeginScanVector(state);
+	D_ASSERT(state.row_index + scan_count <= state.current->start + state.current->count);
+	state.current->Filter(state, scan_count, result, sel, approved_tuple_count, filter);
+	state.row_index += scan_count;
+	state.internal_index = state.row_index;
+}
+
 void ColumnData::FilterScan(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result,
                             SelectionVector &sel, idx_t s_count) {
 	Scan(transaction, vector_index, state, result);
@@ -370,12 +448,82 @@ FilterPropagateResult ColumnData::CheckZonemap(ColumnScanState &state, TableFilt
 	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
 }
 
+static bool BloomFilterContainsAny(const BloomFilter &bloom_filter, const vector<Value> &values) {
+	Vector values_vector(values[0].type(), values.size());
+	for (idx_t i = 0; i < values.size(); i++) {
+		values_vector.SetValue(i, values[i]);
+	}
+	Vector hashes(LogicalType::HASH, values.size());
+	VectorOperations::Hash(values_vector, hashes, values.size());
+	hashes.Flatten(values.size());
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
+	for (idx_t i = 0; i < values.size(); i++) {
+		if (bloom_filter.Lookup(hash_data[i])) {
+			return true;
+		}
+	}
+	return false;
+}
+
+//! Returns false if the filter can only pass values that are definitely not in the bloom filter
+static bool BloomFilterCanMatch(const BloomFilter &bloom_filter, const TableFilter &filter, const LogicalType &type) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		if (constant_filter.comparison_type != ExpressionType::COMPARE_EQUAL ||
+		    constant_filter.constant.type() != type) {
+			return true;
+		}
+		return BloomFilterContainsAny(bloom_filter, {constant_filter.constant});
+	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter.Cast<InFilter>();
+		if (in_filter.values[0].type() != type) {
+			return true;
+		}
+		return BloomFilterContainsAny(bloom_filter, in_filter.values);
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction_filter = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction_filter.child_filters) {
+			if (!BloomFilterCanMatch(bloom_filter, *child_filter, type)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction_filter = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : conjunction_filter.child_filters) {
+			if (BloomFilterCanMatch(bloom_filter, *child_filter, type)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	default:
+		return true;
+	}
+}
+
 FilterPropagateResult ColumnData::CheckZonemap(TableFilter &filter) {
 	if (!stats) {
 		throw InternalException("ColumnData::CheckZonemap called on a column without stats");
 	}
-	lock_guard<mutex> l(stats_lock);
-	return filter.CheckStatistics(stats->statistics);
+	shared_ptr<BloomFilter> column_bloom_filter;
+	{
+		lock_guard<mutex> l(stats_lock);
+		auto prune_result = filter.CheckStatistics(stats->statistics);
+		if (prune_result != FilterPropagateResult::NO_PRUNING_POSSIBLE || !bloom_filter) {
+			return prune_result;
+		}
+		column_bloom_filter = bloom_filter;
+	}
+	// the min/max statistics cannot prune the filter - check if any of the values it looks for can be in the column
+	if (!BloomFilterCanMatch(*column_bloom_filter, filter, type)) {
+		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	}
+	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
 }
 
 unique_ptr<BaseStatistics> ColumnData::GetStatistics() {
@@ -386,6 +534,49 @@ unique_ptr<BaseStatistics> ColumnData::GetStatistics() {
 	return stats->statistics.ToUnique();
 }
 
+shared_ptr<BloomFilter> ColumnData::GetBloomFilter() const {
+	lock_guard<mutex> l(stats_lock);
+	return bloom_filter;
+}
+
+void ColumnData::InitializeBloomFilter() {
+	if (GetBloomFilter()) {
+		// the column has not changed since the bloom filter was built
+		return;
+	}
+	// hash all committed values of the column, so that the filter can be sized on the number of distinct hashes
+	auto row_count = count.load();
+	vector<hash_t> hashes;
+	hashes.reserve(row_count);
+
+	ColumnScanState state;
+	state.Initialize(type, nullptr);
+	InitializeScan(state);
+	for (idx_t vector_index = 0; vector_index * STANDARD_VECTOR_SIZE < row_count; vector_index++) {
+		Vector scan_vector(type);
+		auto scan_count = ScanCommitted(vector_index, state, scan_vector, true);
+
+		Vector hash_vector(LogicalType::HASH);
+		VectorOperations::Hash(scan_vector, hash_vector, scan_count);
+		hash_vector.Flatten(scan_count);
+		auto hash_data = FlatVector::GetData<hash_t>(hash_vector);
+		hashes.insert(hashes.end(), hash_data, hash_data + scan_count);
+	}
+	std::sort(hashes.begin(), hashes.end());
+	auto distinct_count = NumericCast<idx_t>(std::unique(hashes.begin(), hashes.end()) - hashes.begin());
+
+	auto result = make_shared_ptr<BloomFilter>(distinct_count, BloomFilter::STORAGE_BITS_PER_KEY);
+	result->Insert(hashes.data(), distinct_count, false);
+
+	lock_guard<mutex> l(stats_lock);
+	bloom_filter = std::move(result);
+}
+
+void ColumnData::ClearBloomFilter() {
+	lock_guard<mutex> l(stats_lock);
+	bloom_filter.reset();
+}
+
 void ColumnData::MergeStatistics(const BaseStatistics &other) {
 	if (!stats) {
 		throw InternalException("ColumnData::MergeStatistics called on a column without stats");
@@ -403,6 +594,7 @@ void ColumnData::MergeIntoStatistics(BaseStatistics &other) {
 }
 
 void ColumnData::InitializeAppend(ColumnAppendState &state) {
+	ClearBloomFilter();
 	auto l = data.Lock();
 	if (data.IsEmpty(l)) {
 		// no segments yet, append an empty segment
@@ -589,6 +781,7 @@ void ColumnData::InitializeColumn(PersistentColumnData &column_data) {
 
 void ColumnData::InitializeColumn(PersistentColumnData &column_data, BaseStatistics &target_stats) {
 	D_ASSERT(type.InternalType() == column_data.physical_type);
+	bloom_filter = std::move(column_data.bloom_filter);
 	// construct the segments based on the data pointers
 	this->count = 0;
 	for (auto &data_pointer : column_data.pointers) {
@@ -656,6 +849,7 @@ void PersistentColumnData::Serialize(Serializer &serializer) const {
 		serializer.WriteList(102, "sub_columns", child_columns.size() - 1,
 		                     [&](Serializer::List &list, idx_t i) { list.WriteElement(child_columns[i + 1]); });
 	}
+	serializer.WritePropertyWithDefault(103, "bloom_filter", bloom_filter);
 }
 
 void PersistentColumnData::DeserializeField(Deserializer &deserializer, field_id_t field_idx, const char *field_name,
@@ -694,6 +888,7 @@ PersistentColumnData PersistentColumnData::Deserialize(Deserializer &deserialize
 	default:
 		break;
 	}
+	deserializer.ReadPropertyWithDefault(103, "bloom_filter", result.bloom_filter);
 	return result;
 }
 
@@ -762,6 +957,7 @@ bool PersistentCollectionData::HasUpdates() const {
 
 PersistentColumnData ColumnData::Serialize() {
 	PersistentColumnData result(type.InternalType(), GetDataPointers());
+	result.bloom_filter = GetBloomFilter();
 	result.has_updates = HasUpdates();
 	return result;
 }
@@ -109,6 +109,42 @@ unique_ptr<AnalyzeState> ColumnDataCheckpointer::DetectBestCompressionMethod(idx
 	    config.options.force_compression != CompressionType::COMPRESSION_AUTO) {
 		forced_method = ForceCompression(compression_functions, config.options.force_compression);
 	}
+	if (forced_method != CompressionType::COMPRESSION_ZSTD) {
+		// older versions of DuckDB cannot read ZSTD segments: ZSTD is only used if it is explicitly requested
+		for (auto &compression_function : compression_functions) {
+			if (compression_function && compression_function->type == CompressionType::COMPRESSION_ZSTD) {
+				compression_function = nullptr;
+			}
+		}
+	}
+	auto sample = config.options.compression_analyze_sample;
+	if (sample < 1.0 && forced_method == CompressionType::COMPRESSION_AUTO) {
+		// pick the compression method by analyzing a sample of the vectors with every method
+		// the analyze step also verifies that a method can store the data - so the chosen method analyzes all vectors
+		auto candidates = compression_functions;
+		auto sample_step = MaxValue<idx_t>(LossyNumericCast<idx_t>(1.0 / sample), 1);
+		auto state = AnalyzeCompressionMethods(forced_method, sample_step, compression_idx);
+		if (state) {
+			auto sampled_idx = compression_idx;
+			for (idx_t i = 0; i < compression_functions.size(); i++) {
+				if (i != sampled_idx) {
+					compression_functions[i] = nullptr;
+				}
+			}
+			state = AnalyzeCompressionMethods(forced_method, 1, compression_idx);
+			if (state) {
+				return state;
+			}
+			// the chosen method cannot store all of the data - fall back to analyzing the other methods
+			candidates[sampled_idx] = nullptr;
+		}
+		compression_functions = std::move(candidates);
+	}
+	return AnalyzeCompressionMethods(forced_method, 1, compression_idx);
+}
+
+unique_ptr<AnalyzeState> ColumnDataCheckpointer::AnalyzeCompressionMethods(CompressionType forced_method,
+                                                                           idx_t sample_step, idx_t &compression_idx) {
 	// set up the analyze states for each compression method
 	vector<unique_ptr<AnalyzeState>> analyze_states;
 	analyze_states.reserve(compression_functions.size());
@@ -120,8 +156,12 @@ unique_ptr<AnalyzeState> ColumnDataCheckpointer::DetectBestCompressionMethod(idx
 		analyze_states.push_back(compression_functions[i]->init_analyze(col_data, col_data.type.InternalType()));
 	}
 
-	// scan over all the segments and run the analyze step
+	// scan over all the segments and run the analyze step on every sample_step'th vector
+	idx_t vector_idx = 0;
 	ScanSegments([&](Vector &scan_vector, idx_t count) {
+		if (vector_idx++ % sample_step != 0) {
+			return;
+		}
 		for (idx_t i = 0; i < compression_functions.size(); i++) {
 			if (!compression_functions[i]) {
 				continue;
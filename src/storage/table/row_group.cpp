@@ -22,17 +22,20 @@
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/execution/adaptive_filter.hpp"
+#include "duckdb/execution/index/bloom_index.hpp"
+#include "duckdb/storage/table/data_table_info.hpp"
 
 namespace duckdb {
 
 RowGroup::RowGroup(RowGroupCollection &collection_p, idx_t start, idx_t count)
-    : SegmentBase<RowGroup>(start, count), collection(collection_p), version_info(nullptr), allocation_size(0) {
+    : SegmentBase<RowGroup>(start, count), collection(collection_p), version_info(nullptr), allocation_size(0),
+      checkpointed(false) {
 	Verify();
 }
 
 RowGroup::RowGroup(RowGroupCollection &collection_p, RowGroupPointer pointer)
     : SegmentBase<RowGroup>(pointer.row_start, pointer.tuple_count), collection(collection_p), version_info(nullptr),
-      allocation_size(0) {
+      allocation_size(0), checkpointed(true) {
 	// deserialize the columns
 	if (pointer.data_pointers.size() != collection_p.GetTypes().size()) {
 		throw IOException("Row group column count is unaligned with table column count. Corrupt file?");
@@ -51,7 +54,7 @@ RowGroup::RowGroup(RowGroupCollection &collection_p, RowGroupPointer pointer)
 
 RowGroup::RowGroup(RowGroupCollection &collection_p, PersistentRowGroupData &data)
     : SegmentBase<RowGroup>(data.start, data.count), collection(collection_p), version_info(nullptr),
-      allocation_size(0) {
+      allocation_size(0), checkpointed(false) {
 	auto &block_manager = GetBlockManager();
 	auto &info = GetTableInfo();
 	auto &types = collection.get().GetTypes();
@@ -281,6 +284,7 @@ unique_ptr<RowGroup> RowGroup::AlterType(RowGroupCollection &new_collection, con
 	// set up the row_group based on this row_group
 	auto row_group = make_uniq<RowGroup>(new_collection, this->start, this->count);
 	row_group->SetVersionInfo(GetOrCreateVersionInfoPtr());
+	row_group->checkpointed = checkpointed;
 	auto &cols = GetColumns();
 	for (idx_t i = 0; i < cols.size(); i++) {
 		if (i == changed_idx) {
@@ -321,6 +325,7 @@ unique_ptr<RowGroup> RowGroup::AddColumn(RowGroupCollection &new_collection, Col
 	// set up the row_group based on this row_group
 	auto row_group = make_uniq<RowGroup>(new_collection, this->start, this->count);
 	row_group->SetVersionInfo(GetOrCreateVersionInfoPtr());
+	row_group->checkpointed = checkpointed;
 	row_group->columns = GetColumns();
 	// now add the new column
 	row_group->columns.push_back(std::move(added_column));
@@ -336,6 +341,7 @@ unique_ptr<RowGroup> RowGroup::RemoveColumn(RowGroupCollection &new_collection,
 
 	auto row_group = make_uniq<RowGroup>(new_collection, this->start, this->count);
 	row_group->SetVersionInfo(GetOrCreateVersionInfoPtr());
+	row_group->checkpointed = checkpointed;
 	// copy over all columns except for the removed one
 	auto &cols = GetColumns();
 	for (idx_t i = 0; i < cols.size(); i++) {
@@ -419,6 +425,9 @@ static idx_t GetFilterScanCount(ColumnScanState &state, TableFilter &filter) {
 	case TableFilterType::IS_NULL:
 	case TableFilterType::IS_NOT_NULL:
 	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::BLOOM_FILTER:
+	case TableFilterType::IN_FILTER:
+	case TableFilterType::DYNAMIC_FILTER:
 		return state.current->start + state.current->count;
 	default: {
 		throw NotImplementedException("Unimplemented filter type for zonemap");
@@ -467,6 +476,28 @@ bool RowGroup::CheckZonemapSegments(CollectionScanState &state) {
 	return true;
 }
 
+void RowGroup::InitializePrefetch(CollectionScanState &state, PrefetchState &prefetch_state) {
+	for (auto &entry : state.GetFilterInfo().GetFilterList()) {
+		if (GetColumn(entry.table_column_index).CheckZonemap(entry.filter) ==
+		    FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+			// the scan skips this row group entirely
+			return;
+		}
+	}
+	auto &column_ids = state.GetColumnIds();
+	for (idx_t i = 0; i < column_ids.size(); i++) {
+		auto column = column_ids[i];
+		if (column == COLUMN_IDENTIFIER_ROW_ID) {
+			continue;
+		}
+		auto &column_data = GetColumn(column);
+		ColumnScanState column_scan;
+		column_scan.Initialize(column_data.type, nullptr);
+		column_data.InitializeScan(column_scan);
+		column_data.InitializePrefetch(prefetch_state, column_scan, count);
+	}
+}
+
 template <TableScanType TYPE>
 void RowGroup::TemplatedScan(TransactionData transaction, CollectionScanState &state, DataChunk &result) {
 	const bool ALLOW_UPDATES = TYPE != TableScanType::TABLE_SCAN_COMMITTED_ROWS_DISALLOW_UPDATES &&
@@ -809,6 +840,7 @@ void RowGroup::InitializeAppend(RowGroupAppendState &append_state) {
 void RowGroup::Append(RowGroupAppendState &state, DataChunk &chunk, idx_t append_count) {
 	// append to the current row_group
 	D_ASSERT(chunk.ColumnCount() == GetColumnCount());
+	checkpointed = false;
 	for (idx_t i = 0; i < GetColumnCount(); i++) {
 		auto &col_data = GetColumn(i);
 		auto prev_allocation_size = col_data.GetAllocationSize();
@@ -899,10 +931,7 @@ RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriteInfo &info) {
 	// first sequentially, and the pointers are written later, so that the
 	// pointers all end up densely packed, and thus more cache-friendly.
 	for (idx_t column_idx = 0; column_idx < GetColumnCount(); column_idx++) {
-		auto &column = GetColumn(column_idx);
-		ColumnCheckpointInfo checkpoint_info(info, column_idx);
-		auto checkpoint_state = column.Checkpoint(*this, checkpoint_info);
-		D_ASSERT(checkpoint_state);
+		auto checkpoint_state = WriteColumnToDisk(info, column_idx);
 
 		auto stats = checkpoint_state->GetStatistics();
 		D_ASSERT(stats);
@@ -931,7 +960,15 @@ bool RowGroup::HasUnloadedDeletes() const {
 	return !deletes_is_loaded;
 }
 
-RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriter &writer) {
+unique_ptr<ColumnCheckpointState> RowGroup::WriteColumnToDisk(RowGroupWriteInfo &info, idx_t column_idx) {
+	auto &column = GetColumn(column_idx);
+	ColumnCheckpointInfo checkpoint_info(info, column_idx);
+	auto checkpoint_state = column.Checkpoint(*this, checkpoint_info);
+	D_ASSERT(checkpoint_state);
+	return checkpoint_state;
+}
+
+vector<CompressionType> RowGroup::InitializeWriteToDisk(RowGroupWriter &writer) {
 	vector<CompressionType> compression_types;
 	compression_types.reserve(columns.size());
 	for (idx_t column_idx = 0; column_idx < GetColumnCount(); column_idx++) {
@@ -944,6 +981,29 @@ RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriter &writer) {
 		compression_types.push_back(writer.GetColumnCompressionType(column_idx));
 	}
 
+	// build the bloom filters of the columns with a BLOOM index, these are written along with the column metadata
+	// this scans the columns before they are checkpointed, as their new segments might still be written concurrently
+	unordered_set<column_t> bloom_filter_columns;
+	GetTableInfo().GetIndexes().Scan([&](Index &index) {
+		if (index.GetIndexType() == BloomIndex::TYPE_NAME) {
+			auto &column_ids = index.GetColumnIds();
+			bloom_filter_columns.insert(column_ids.begin(), column_ids.end());
+		}
+		return false;
+	});
+	for (idx_t column_idx = 0; column_idx < GetColumnCount(); column_idx++) {
+		auto &column = GetColumn(column_idx);
+		if (bloom_filter_columns.find(column_idx) != bloom_filter_columns.end()) {
+			column.InitializeBloomFilter();
+		} else {
+			column.ClearBloomFilter();
+		}
+	}
+	return compression_types;
+}
+
+RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriter &writer) {
+	auto compression_types = InitializeWriteToDisk(writer);
 	RowGroupWriteInfo info(writer.GetPartialBlockManager(), compression_types, writer.GetCheckpointType());
 	return WriteToDisk(info);
 }
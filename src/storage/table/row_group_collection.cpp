@@ -1,18 +1,24 @@
 #include "duckdb/storage/table/row_group_collection.hpp"
 
 #include "duckdb/common/serializer/binary_deserializer.hpp"
+#include "duckdb/common/sort/sort.hpp"
+#include "duckdb/common/sort/sorted_block.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/execution/index/bloom_index.hpp"
 #include "duckdb/execution/index/bound_index.hpp"
 #include "duckdb/execution/task_error_manager.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/planner/constraints/bound_not_null_constraint.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/storage/checkpoint/table_data_writer.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/metadata/metadata_reader.hpp"
 #include "duckdb/storage/table/append_state.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
 #include "duckdb/storage/table/persistent_table_data.hpp"
+#include "duckdb/storage/table/row_group_prefetcher.hpp"
 #include "duckdb/storage/table/row_group_segment_tree.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
 #include "duckdb/storage/table_storage_info.hpp"
@@ -185,11 +191,13 @@ void RowGroupCollection::InitializeParallelScan(ParallelCollectionScanState &sta
 
 bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollectionScanState &state,
                                           CollectionScanState &scan_state) {
+	vector<RowGroup *> prefetch_row_groups;
 	while (true) {
 		idx_t vector_index;
 		idx_t max_row;
 		RowGroupCollection *collection;
 		RowGroup *row_group;
+		prefetch_row_groups.clear();
 		{
 			// select the next row group to scan from the parallel state
 			lock_guard<mutex> l(state.lock);
@@ -199,29 +207,74 @@ bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollec
 			}
 			collection = state.collection;
 			row_group = state.current_row_group;
-			if (ClientConfig::GetConfig(context).verify_parallelism) {
-				vector_index = state.vector_index;
-				max_row = state.current_row_group->start +
-				          MinValue<idx_t>(state.current_row_group->count,
-				                          STANDARD_VECTOR_SIZE * state.vector_index + STANDARD_VECTOR_SIZE);
-				D_ASSERT(vector_index * STANDARD_VECTOR_SIZE < state.current_row_group->count);
-				state.vector_index++;
-				if (state.vector_index * STANDARD_VECTOR_SIZE >= state.current_row_group->count) {
-					state.current_row_group = row_groups->GetNextSegment(state.current_row_group);
-					state.vector_index = 0;
+			vector_index = state.vector_index;
+			// rows that are appended while we scan (e.g. by INSERT INTO tbl SELECT * FROM tbl) are not scanned
+			idx_t row_group_rows = 0;
+			if (state.max_row > row_group->start) {
+				row_group_rows = MinValue<idx_t>(row_group->count, state.max_row - row_group->start);
+			}
+			if (row_group_rows == 0) {
+				// this row group was appended after the scan started
+				state.current_row_group = nullptr;
+				break;
+			}
+			D_ASSERT(vector_index * STANDARD_VECTOR_SIZE < row_group_rows);
+			if (state.prefetcher) {
+				// hand the row groups that follow the current row group to the prefetcher, so their blocks are read
+				// in the background while the current row group is being scanned
+				if (!state.prefetch_row_group || state.prefetch_row_group->index < row_group->index) {
+					state.prefetch_row_group = row_group;
 				}
+				const auto last_prefetch_index = row_group->index + state.prefetcher->row_group_count;
+				while (true) {
+					auto next_row_group = row_groups->GetNextSegment(state.prefetch_row_group);
+					if (!next_row_group || next_row_group->index > last_prefetch_index) {
+						break;
+					}
+					prefetch_row_groups.push_back(next_row_group);
+					state.prefetch_row_group = next_row_group;
+				}
+			}
+
+			// by default, we scan (the rest of) the row group
+			const auto row_group_vector_count = (row_group_rows + STANDARD_VECTOR_SIZE - 1) / STANDARD_VECTOR_SIZE;
+			idx_t morsel_vector_count = row_group_vector_count - vector_index;
+			if (ClientConfig::GetConfig(context).verify_parallelism) {
+				morsel_vector_count = 1;
 			} else {
-				state.processed_rows += state.current_row_group->count;
-				vector_index = 0;
-				max_row = state.current_row_group->start + state.current_row_group->count;
+				// near the end of the scan, there are fewer row groups left than threads
+				// we split up the remaining rows, so that threads that would otherwise be idle can help out
+				const auto scan_start = row_group->start + vector_index * STANDARD_VECTOR_SIZE;
+				const auto remaining_rows = state.max_row > scan_start ? state.max_row - scan_start : 0;
+				const auto thread_count = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+				if (remaining_rows < thread_count * Storage::ROW_GROUP_SIZE) {
+					const auto remaining_vectors = (remaining_rows + STANDARD_VECTOR_SIZE - 1) / STANDARD_VECTOR_SIZE;
+					const auto split_vector_count =
+					    MaxValue<idx_t>((remaining_vectors + thread_count - 1) / thread_count,
+					                    ParallelCollectionScanState::MIN_MORSEL_VECTOR_COUNT);
+					morsel_vector_count = MinValue<idx_t>(morsel_vector_count, split_vector_count);
+				}
+			}
+			const auto end_vector_index = vector_index + morsel_vector_count;
+			max_row = row_group->start + MinValue<idx_t>(row_group_rows, end_vector_index * STANDARD_VECTOR_SIZE);
+			state.processed_rows += max_row - (row_group->start + vector_index * STANDARD_VECTOR_SIZE);
+			if (end_vector_index == row_group_vector_count) {
 				state.current_row_group = row_groups->GetNextSegment(state.current_row_group);
+				state.vector_index = 0;
+			} else {
+				state.vector_index = end_vector_index;
 			}
-			max_row = MinValue<idx_t>(max_row, state.max_row);
 			scan_state.batch_index = ++state.batch_index;
 		}
 		D_ASSERT(collection);
 		D_ASSERT(row_group);
 
+		for (auto &prefetch_row_group : prefetch_row_groups) {
+			PrefetchState prefetch_state;
+			prefetch_row_group->InitializePrefetch(scan_state, prefetch_state);
+			state.prefetcher->Prefetch(std::move(prefetch_state.blocks));
+		}
+
 		// initialize the scan for this row group
 		bool need_to_scan = InitializeScanInRowGroup(scan_state, *collection, *row_group, vector_index, max_row);
 		if (!need_to_scan) {
@@ -699,6 +752,11 @@ struct CollectionCheckpointState {
 	      global_stats(global_stats) {
 		writers.resize(segments.size());
 		write_data.resize(segments.size());
+		compression_types.resize(segments.size());
+		write_info.resize(segments.size());
+		// with background threads the columns of a row group are written in separate tasks, so that tables with few
+		// row groups but many columns are also checkpointed in parallel
+		parallel_columns = collection.GetTypes().size() > 1 && writer.GetScheduler().NumberOfBackgroundThreads() > 0;
 	}
 
 	RowGroupCollection &collection;
@@ -709,6 +767,11 @@ struct CollectionCheckpointState {
 	vector<RowGroupWriteData> write_data;
 	TableStatistics &global_stats;
 	mutex write_lock;
+	//! Whether or not the columns of the row groups are written by separate tasks
+	bool parallel_columns;
+	//! The compression types and write info of the row groups, used by the tasks writing their columns
+	vector<vector<CompressionType>> compression_types;
+	vector<unique_ptr<RowGroupWriteInfo>> write_info;
 };
 
 class BaseCheckpointTask : public BaseExecutorTask {
@@ -721,6 +784,23 @@ protected:
 	CollectionCheckpointState &checkpoint_state;
 };
 
+class ColumnCheckpointTask : public BaseCheckpointTask {
+public:
+	ColumnCheckpointTask(CollectionCheckpointState &checkpoint_state, idx_t index, idx_t column_idx)
+	    : BaseCheckpointTask(checkpoint_state), index(index), column_idx(column_idx) {
+	}
+
+	void ExecuteTask() override {
+		auto &row_group = *checkpoint_state.segments[index].node;
+		auto &write_info = *checkpoint_state.write_info[index];
+		checkpoint_state.write_data[index].states[column_idx] = row_group.WriteColumnToDisk(write_info, column_idx);
+	}
+
+private:
+	idx_t index;
+	idx_t column_idx;
+};
+
 class CheckpointTask : public BaseCheckpointTask {
 public:
 	CheckpointTask(CollectionCheckpointState &checkpoint_state, idx_t index)
@@ -731,7 +811,22 @@ public:
 		auto &entry = checkpoint_state.segments[index];
 		auto &row_group = *entry.node;
 		checkpoint_state.writers[index] = checkpoint_state.writer.GetRowGroupWriter(*entry.node);
-		checkpoint_state.write_data[index] = row_group.WriteToDisk(*checkpoint_state.writers[index]);
+		auto &row_group_writer = *checkpoint_state.writers[index];
+		if (!checkpoint_state.parallel_columns) {
+			checkpoint_state.write_data[index] = row_group.WriteToDisk(row_group_writer);
+			return;
+		}
+		// schedule a task for every column - the statistics are gathered after all tasks have finished
+		checkpoint_state.compression_types[index] = row_group.InitializeWriteToDisk(row_group_writer);
+		auto &partial_block_manager = row_group_writer.GetPartialBlockManager();
+		checkpoint_state.write_info[index] = make_uniq<RowGroupWriteInfo>(
+		    partial_block_manager, checkpoint_state.compression_types[index], row_group_writer.GetCheckpointType());
+		auto column_count = checkpoint_state.collection.GetTypes().size();
+		checkpoint_state.write_data[index].states.resize(column_count);
+		for (idx_t column_idx = 0; column_idx < column_count; column_idx++) {
+			auto column_task = make_uniq<ColumnCheckpointTask>(checkpoint_state, index, column_idx);
+			checkpoint_state.executor.ScheduleTask(std::move(column_task));
+		}
 	}
 
 private:
@@ -746,14 +841,19 @@ struct VacuumState {
 	idx_t row_start = 0;
 	idx_t next_vacuum_idx = 0;
 	vector<idx_t> row_group_counts;
+	//! The columns by which the rows of the table are sorted (if any)
+	vector<PhysicalIndex> sort_columns;
+	//! For each row group, whether or not its rows need to be sorted
+	vector<bool> needs_sort;
 };
 
 class VacuumTask : public BaseCheckpointTask {
 public:
 	VacuumTask(CollectionCheckpointState &checkpoint_state, VacuumState &vacuum_state, idx_t segment_idx,
-	           idx_t merge_count, idx_t target_count, idx_t merge_rows, idx_t row_start)
+	           idx_t merge_count, idx_t target_count, idx_t merge_rows, idx_t row_start, bool sort_rows = false)
 	    : BaseCheckpointTask(checkpoint_state), vacuum_state(vacuum_state), segment_idx(segment_idx),
-	      merge_count(merge_count), target_count(target_count), merge_rows(merge_rows), row_start(row_start) {
+	      merge_count(merge_count), target_count(target_count), merge_rows(merge_rows), row_start(row_start),
+	      sort_rows(sort_rows) {
 	}
 
 	void ExecuteTask() override {
@@ -788,6 +888,46 @@ public:
 		// fill the new row group with the merged rows
 		TableAppendState append_state;
 		new_row_groups[current_append_idx]->InitializeAppend(append_state.row_group_append_state);
+		auto append_chunk = [&](DataChunk &chunk) {
+			idx_t remaining = chunk.size();
+			while (remaining > 0) {
+				idx_t append_count =
+				    MinValue<idx_t>(remaining, Storage::ROW_GROUP_SIZE - append_counts[current_append_idx]);
+				new_row_groups[current_append_idx]->Append(append_state.row_group_append_state, chunk, append_count);
+				append_counts[current_append_idx] += append_count;
+				remaining -= append_count;
+				const bool row_group_full = append_counts[current_append_idx] == Storage::ROW_GROUP_SIZE;
+				const bool last_row_group = current_append_idx + 1 >= new_row_groups.size();
+				if (remaining > 0 || (row_group_full && !last_row_group)) {
+					// move to the next row group
+					current_append_idx++;
+					new_row_groups[current_append_idx]->InitializeAppend(append_state.row_group_append_state);
+					// slice chunk for the next append
+					chunk.Slice(append_count, remaining);
+				}
+			}
+		};
+
+		// when sorting, the rows are first gathered in a sort and appended once all of them have been scanned
+		auto &buffer_manager = BufferManager::GetBufferManager(checkpoint_state.writer.GetDatabase());
+		unique_ptr<GlobalSortState> global_sort;
+		LocalSortState local_sort;
+		DataChunk sort_chunk;
+		if (sort_rows) {
+			vector<BoundOrderByNode> orders;
+			vector<LogicalType> sort_types;
+			for (auto &column : vacuum_state.sort_columns) {
+				auto &type = types[column.index];
+				orders.emplace_back(OrderType::ASCENDING, OrderByNullType::NULLS_LAST,
+				                    make_uniq<BoundReferenceExpression>(type, orders.size()));
+				sort_types.push_back(type);
+			}
+			RowLayout payload_layout;
+			payload_layout.Initialize(types);
+			global_sort = make_uniq<GlobalSortState>(buffer_manager, orders, payload_layout);
+			local_sort.Initialize(*global_sort, buffer_manager);
+			sort_chunk.InitializeEmpty(sort_types);
+		}
 
 		TableScanState scan_state;
 		scan_state.Initialize(column_ids);
@@ -813,29 +953,36 @@ public:
 					break;
 				}
 				scan_chunk.Flatten();
-				idx_t remaining = scan_chunk.size();
-				while (remaining > 0) {
-					idx_t append_count =
-					    MinValue<idx_t>(remaining, Storage::ROW_GROUP_SIZE - append_counts[current_append_idx]);
-					new_row_groups[current_append_idx]->Append(append_state.row_group_append_state, scan_chunk,
-					                                           append_count);
-					append_counts[current_append_idx] += append_count;
-					remaining -= append_count;
-					const bool row_group_full = append_counts[current_append_idx] == Storage::ROW_GROUP_SIZE;
-					const bool last_row_group = current_append_idx + 1 >= new_row_groups.size();
-					if (remaining > 0 || (row_group_full && !last_row_group)) {
-						// move to the next row group
-						current_append_idx++;
-						new_row_groups[current_append_idx]->InitializeAppend(append_state.row_group_append_state);
-						// slice chunk for the next append
-						scan_chunk.Slice(append_count, remaining);
-					}
+				if (!global_sort) {
+					append_chunk(scan_chunk);
+					continue;
+				}
+				for (idx_t i = 0; i < vacuum_state.sort_columns.size(); i++) {
+					sort_chunk.data[i].Reference(scan_chunk.data[vacuum_state.sort_columns[i].index]);
 				}
+				sort_chunk.SetCardinality(scan_chunk);
+				local_sort.SinkChunk(sort_chunk, scan_chunk);
 			}
 			// drop the row group after merging
 			current_row_group.CommitDrop();
 			checkpoint_state.segments[c_idx].node.reset();
 		}
+		if (global_sort) {
+			global_sort->AddLocalState(local_sort);
+			global_sort->PrepareMergePhase();
+			while (global_sort->sorted_blocks.size() > 1) {
+				global_sort->InitializeMergeRound();
+				MergeSorter merge_sorter(*global_sort, buffer_manager);
+				merge_sorter.PerformInMergeRound();
+				global_sort->CompleteMergeRound(false);
+			}
+			PayloadScanner scanner(*global_sort);
+			while (scanner.Remaining()) {
+				scan_chunk.Reset();
+				scanner.Scan(scan_chunk);
+				append_chunk(scan_chunk);
+			}
+		}
 		idx_t total_append_count = 0;
 		for (idx_t target_idx = 0; target_idx < target_count; target_idx++) {
 			auto &row_group = new_row_groups[target_idx];
@@ -862,20 +1009,36 @@ private:
 	idx_t target_count;
 	idx_t merge_rows;
 	idx_t row_start;
+	//! Whether or not the rows are sorted by the sort columns of the table while merging
+	bool sort_rows;
 };
 
 void RowGroupCollection::InitializeVacuumState(CollectionCheckpointState &checkpoint_state, VacuumState &state,
                                                vector<SegmentNode<RowGroup>> &segments) {
 	bool is_full_checkpoint = checkpoint_state.writer.GetCheckpointType() == CheckpointType::FULL_CHECKPOINT;
-	// currently we can only vacuum deletes if we are doing a full checkpoint and there are no indexes
-	state.can_vacuum_deletes = info->GetIndexes().Empty() && is_full_checkpoint;
+	// currently we can only vacuum deletes if we are doing a full checkpoint and there are no indexes that refer to
+	// row ids - BLOOM indexes only mark the columns to build bloom filters for
+	bool has_row_id_indexes = false;
+	info->GetIndexes().Scan([&](Index &index) {
+		has_row_id_indexes = index.GetIndexType() != BloomIndex::TYPE_NAME;
+		return has_row_id_indexes;
+	});
+	state.can_vacuum_deletes = !has_row_id_indexes && is_full_checkpoint;
 	if (!state.can_vacuum_deletes) {
 		return;
 	}
+	// row groups that were appended to since the last checkpoint are re-sorted by the sort key of the table
+	// after a VACUUM, all row groups are re-sorted
+	state.sort_columns = checkpoint_state.writer.GetSortColumns();
+	const bool reorder_all = info->IsReorderRequested();
+	info->SetReorderRequested(false);
 	// obtain the set of committed row counts for each row group
 	state.row_group_counts.reserve(segments.size());
 	for (auto &entry : segments) {
 		auto &row_group = *entry.node;
+		if (!state.sort_columns.empty()) {
+			state.needs_sort.push_back(reorder_all || !row_group.IsCheckpointed());
+		}
 		auto row_group_count = row_group.GetCommittedRowCount();
 		if (row_group_count == 0) {
 			// empty row group - we can drop it entirely
@@ -898,6 +1061,9 @@ bool RowGroupCollection::ScheduleVacuumTasks(CollectionCheckpointState &checkpoi
 		// this segment is being vacuumed by a previously scheduled task
 		return true;
 	}
+	if (!state.needs_sort.empty() && state.needs_sort[segment_idx]) {
+		return ScheduleSortTask(checkpoint_state, state, segment_idx);
+	}
 	if (state.row_group_counts[segment_idx] == 0) {
 		// segment was already dropped - skip
 		D_ASSERT(!checkpoint_state.segments[segment_idx].node);
@@ -922,6 +1088,10 @@ bool RowGroupCollection::ScheduleVacuumTasks(CollectionCheckpointState &checkpoi
 		merge_count = 0;
 		merge_rows = 0;
 		for (next_idx = segment_idx; next_idx < checkpoint_state.segments.size(); next_idx++) {
+			if (!state.needs_sort.empty() && state.needs_sort[next_idx]) {
+				// row groups that need to be sorted are merged separately
+				break;
+			}
 			if (state.row_group_counts[next_idx] == 0) {
 				continue;
 			}
@@ -953,6 +1123,39 @@ bool RowGroupCollection::ScheduleVacuumTasks(CollectionCheckpointState &checkpoi
 	return true;
 }
 
+bool RowGroupCollection::ScheduleSortTask(CollectionCheckpointState &checkpoint_state, VacuumState &state,
+                                          idx_t segment_idx) {
+	// bound the work (and memory) of a single sort task - a VACUUM re-sorts every row group of the table,
+	// which we then sort in runs of at most MAX_SORT_COUNT row groups
+	static constexpr const idx_t MAX_SORT_COUNT = 16;
+
+	// sort the consecutive row groups that need to be sorted together
+	idx_t merge_rows = 0;
+	idx_t merge_count = 0;
+	idx_t next_idx;
+	for (next_idx = segment_idx; next_idx < checkpoint_state.segments.size(); next_idx++) {
+		if (!state.needs_sort[next_idx] || merge_count >= MAX_SORT_COUNT) {
+			break;
+		}
+		if (state.row_group_counts[next_idx] == 0) {
+			continue;
+		}
+		merge_rows += state.row_group_counts[next_idx];
+		merge_count++;
+	}
+	state.next_vacuum_idx = next_idx;
+	if (merge_rows == 0) {
+		// all row groups were dropped - nothing to sort
+		return true;
+	}
+	idx_t target_count = (merge_rows + Storage::ROW_GROUP_SIZE - 1) / Storage::ROW_GROUP_SIZE;
+	auto sort_task = make_uniq<VacuumTask>(checkpoint_state, state, segment_idx, merge_count, target_count,
+	                                       merge_rows, state.row_start, true);
+	checkpoint_state.executor.ScheduleTask(std::move(sort_task));
+	state.row_start += merge_rows;
+	return true;
+}
+
 //===--------------------------------------------------------------------===//
 // Checkpoint
 //===--------------------------------------------------------------------===//
@@ -1007,9 +1210,18 @@ void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &gl
 		if (!row_group_writer) {
 			throw InternalException("Missing row group writer for index %llu", segment_idx);
 		}
-		auto pointer =
-		    row_group.Checkpoint(std::move(checkpoint_state.write_data[segment_idx]), *row_group_writer, global_stats);
+		auto &write_data = checkpoint_state.write_data[segment_idx];
+		if (checkpoint_state.parallel_columns) {
+			for (auto &column_state : write_data.states) {
+				write_data.statistics.push_back(column_state->GetStatistics()->Copy());
+			}
+		}
+		auto pointer = row_group.Checkpoint(std::move(write_data), *row_group_writer, global_stats);
 		writer.AddRowGroup(std::move(pointer), std::move(row_group_writer));
+		if (vacuum_state.can_vacuum_deletes) {
+			// any rows that needed to be sorted have been sorted
+			row_group.SetCheckpointed();
+		}
 		row_groups->AppendSegment(l, std::move(entry.node));
 		new_total_rows += row_group.count;
 	}
@@ -0,0 +1,105 @@
+#include "duckdb/storage/table/row_group_prefetcher.hpp"
+
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+#include <condition_variable>
+
+namespace duckdb {
+
+struct RowGroupPrefetchState {
+	explicit RowGroupPrefetchState(BufferManager &buffer_manager)
+	    : buffer_manager(buffer_manager), stopped(false), running_reads(0) {
+	}
+
+	BufferManager &buffer_manager;
+	//! Protects the pending reads - it is not held while blocks are read, so that scans can schedule reads meanwhile
+	mutex lock;
+	//! Whether or not the prefetcher has been stopped
+	bool stopped;
+	//! The blocks of the reads that have not started yet
+	vector<vector<shared_ptr<BlockHandle>>> pending;
+	//! The amount of reads that have started but not finished yet
+	atomic<idx_t> running_reads;
+	//! Signaled when a read has finished, so that stopping the prefetcher can wait for the running reads
+	std::condition_variable read_finished;
+};
+
+class RowGroupPrefetchTask : public Task {
+public:
+	explicit RowGroupPrefetchTask(shared_ptr<RowGroupPrefetchState> state_p) : state(std::move(state_p)) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		vector<shared_ptr<BlockHandle>> blocks;
+		{
+			lock_guard<mutex> l(state->lock);
+			if (state->stopped || state->pending.empty()) {
+				return TaskExecutionResult::TASK_FINISHED;
+			}
+			blocks = std::move(state->pending.front());
+			state->pending.erase_at(0);
+			state->running_reads++;
+		}
+		// prefetching is only a performance suggestion - if the read fails (e.g. because we run out of memory)
+		// the scan reads the blocks itself and reports the error there
+		try {
+			state->buffer_manager.Prefetch(blocks);
+		} catch (...) {
+		}
+		state->running_reads--;
+		{
+			// taking the lock ensures that a thread that is about to wait in Stop() does not miss the signal
+			lock_guard<mutex> l(state->lock);
+		}
+		state->read_finished.notify_all();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	shared_ptr<RowGroupPrefetchState> state;
+};
+
+RowGroupPrefetcher::RowGroupPrefetcher(BufferManager &buffer_manager, TaskScheduler &scheduler,
+                                       idx_t row_group_count)
+    : row_group_count(row_group_count), scheduler(scheduler),
+      state(make_shared_ptr<RowGroupPrefetchState>(buffer_manager)), token(scheduler.CreateProducer()) {
+}
+
+RowGroupPrefetcher::~RowGroupPrefetcher() {
+	Stop();
+}
+
+void RowGroupPrefetcher::Prefetch(vector<shared_ptr<BlockHandle>> blocks) {
+	if (blocks.empty()) {
+		return;
+	}
+	{
+		lock_guard<mutex> l(state->lock);
+		if (state->stopped) {
+			return;
+		}
+		state->pending.push_back(std::move(blocks));
+	}
+	scheduler.ScheduleTask(*token, make_shared_ptr<RowGroupPrefetchTask>(state));
+}
+
+void RowGroupPrefetcher::Stop() {
+	if (!token) {
+		return;
+	}
+	{
+		unique_lock<mutex> l(state->lock);
+		state->stopped = true;
+		state->pending.clear();
+		state->read_finished.wait(l, [&]() { return state->running_reads == 0; });
+	}
+	// remove the tasks that have not been picked up by a thread yet
+	shared_ptr<Task> task;
+	while (scheduler.GetTaskFromProducer(*token, task)) {
+		task.reset();
+	}
+	token.reset();
+}
+
+} // namespace duckdb
@@ -5,6 +5,7 @@
 #include "duckdb/storage/table/column_segment.hpp"
 #include "duckdb/storage/table/row_group.hpp"
 #include "duckdb/storage/table/row_group_collection.hpp"
+#include "duckdb/storage/table/row_group_prefetcher.hpp"
 #include "duckdb/storage/table/row_group_segment_tree.hpp"
 #include "duckdb/transaction/duck_transaction.hpp"
 
@@ -148,7 +149,10 @@ TableScanOptions &CollectionScanState::GetOptions() {
 }
 
 ParallelCollectionScanState::ParallelCollectionScanState()
-    : collection(nullptr), current_row_group(nullptr), processed_rows(0) {
+    : collection(nullptr), current_row_group(nullptr), processed_rows(0), prefetch_row_group(nullptr) {
+}
+
+ParallelCollectionScanState::~ParallelCollectionScanState() {
 }
 
 CollectionScanState::CollectionScanState(TableScanState &parent_p)
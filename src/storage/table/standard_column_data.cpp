@@ -76,6 +76,52 @@ idx_t StandardColumnData::ScanCount(ColumnScanState &state, Vector &result, idx_
 	return scan_count;
 }
 
+void StandardColumnData::FilterScan(TransactionData transaction, idx_t vector_index, ColumnScanState &state,
+                                    Vector &result, SelectionVector &sel, idx_t count) {
+	D_ASSERT(state.row_index == state.child_states[0].row_index);
+	auto target_count = GetVectorCount(vector_index);
+	bool force_fetch_row = state.scan_options && state.scan_options->force_fetch_row;
+	if (count * LATE_MATERIALIZATION_RATIO > target_count || HasUpdates() || validity.HasUpdates() ||
+	    force_fetch_row || result.GetVectorType() != VectorType::FLAT_VECTOR) {
+		ColumnData::FilterScan(transaction, vector_index, state, result, sel, count);
+		return;
+	}
+	// late materialization: the filters selected only a few rows, only scan (and decompress) those
+	ScanVectorSelection(state, result, target_count, sel, count);
+	validity.ScanVectorSelection(state.child_states[0], result, target_count, sel, count);
+}
+
+void StandardColumnData::Select(TransactionData transaction, idx_t vector_index, ColumnScanState &state,
+                                Vector &result, SelectionVector &sel, idx_t &count, const TableFilter &filter) {
+	D_ASSERT(state.row_index == state.child_states[0].row_index);
+	auto target_count = GetVectorCount(vector_index);
+	if (!CanFilterVector(state, target_count, result, filter)) {
+		ColumnData::Select(transaction, vector_index, state, result, sel, count, filter);
+		return;
+	}
+	// evaluate the filter on the compressed data, and remove the NULL values afterwards
+	FilterVector(state, target_count, result, sel, count, filter);
+	validity.Scan(transaction, vector_index, state.child_states[0], result, target_count);
+	if (count == 0) {
+		return;
+	}
+	UnifiedVectorFormat vdata;
+	result.ToUnifiedFormat(target_count, vdata);
+	if (vdata.validity.AllValid()) {
+		return;
+	}
+	SelectionVector valid_sel(count);
+	idx_t valid_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = sel.get_index(i);
+		if (vdata.validity.RowIsValid(vdata.sel->get_index(idx))) {
+			valid_sel.set_index(valid_count++, idx);
+		}
+	}
+	sel.Initialize(valid_sel);
+	count = valid_count;
+}
+
 void StandardColumnData::InitializeAppend(ColumnAppendState &state) {
 	ColumnData::InitializeAppend(state);
 	ColumnAppendState child_append;
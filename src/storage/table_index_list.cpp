@@ -173,13 +173,13 @@ vector<IndexStorageInfo> TableIndexList::GetStorageInfos(const case_insensitive_
 	for (auto &index : indexes) {
 		if (index->IsBound()) {
 			auto index_storage_info = index->Cast<BoundIndex>().GetStorageInfo(options, false);
-			D_ASSERT(index_storage_info.IsValid() && !index_storage_info.name.empty());
+			D_ASSERT(index_storage_info.HasInfo() && !index_storage_info.name.empty());
 			index_storage_infos.push_back(index_storage_info);
 			continue;
 		}
 
 		auto index_storage_info = index->Cast<UnboundIndex>().GetStorageInfo();
-		D_ASSERT(index_storage_info.IsValid() && !index_storage_info.name.empty());
+		D_ASSERT(index_storage_info.HasInfo() && !index_storage_info.name.empty());
 		index_storage_infos.push_back(index_storage_info);
 	}
 
@@ -1,6 +1,8 @@
 #include "duckdb/storage/temporary_memory_manager.hpp"
 
+#include "duckdb/common/chrono.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 
@@ -9,8 +11,8 @@
 namespace duckdb {
 
 TemporaryMemoryState::TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager_p,
-                                           idx_t minimum_reservation_p)
-    : temporary_memory_manager(temporary_memory_manager_p), remaining_size(0),
+                                           ClientContext &context_p, idx_t minimum_reservation_p)
+    : temporary_memory_manager(temporary_memory_manager_p), context(context_p), remaining_size(0),
       minimum_reservation(minimum_reservation_p), reservation(0), materialization_penalty(1) {
 }
 
@@ -104,7 +106,7 @@ unique_ptr<TemporaryMemoryState> TemporaryMemoryManager::Register(ClientContext
 
 	auto minimum_reservation = MinValue(num_threads * MINIMUM_RESERVATION_PER_STATE_PER_THREAD,
 	                                    memory_limit / MINIMUM_RESERVATION_MEMORY_LIMIT_DIVISOR);
-	auto result = unique_ptr<TemporaryMemoryState>(new TemporaryMemoryState(*this, minimum_reservation));
+	auto result = unique_ptr<TemporaryMemoryState>(new TemporaryMemoryState(*this, context, minimum_reservation));
 	SetRemainingSize(*result, result->GetMinimumReservation());
 	SetReservation(*result, result->GetMinimumReservation());
 	active_states.insert(*result);
@@ -113,6 +115,38 @@ unique_ptr<TemporaryMemoryState> TemporaryMemoryManager::Register(ClientContext
 	return result;
 }
 
+void TemporaryMemoryManager::WaitForAdmission(ClientContext &context) {
+	static constexpr const int64_t WAIT_INTERVAL_MS = 100;
+	const auto timeout = DBConfig::GetConfig(context).options.admission_timeout;
+	if (timeout == 0) {
+		return;
+	}
+	auto guard = Lock();
+	UpdateConfiguration(context);
+	const auto deadline = std::chrono::steady_clock::now() + milliseconds(timeout);
+	while (HasMemoryPressure(context) && !context.interrupted) {
+		const auto now = std::chrono::steady_clock::now();
+		if (now >= deadline) {
+			// we have waited long enough, let the query run (and spill) anyway
+			break;
+		}
+		// wake up periodically to check if the query was interrupted
+		const auto wait_until = MinValue(deadline, now + milliseconds(WAIT_INTERVAL_MS));
+		admission_cv.wait_until(guard, wait_until);
+	}
+}
+
+bool TemporaryMemoryManager::HasMemoryPressure(ClientContext &context) const {
+	// the states of this client are not counted, as this client cannot free them while it waits for admission
+	idx_t other_remaining_size = 0;
+	for (auto &state : active_states) {
+		if (state.get().context.get() != &context) {
+			other_remaining_size += state.get().GetRemainingSize();
+		}
+	}
+	return other_remaining_size > memory_limit;
+}
+
 void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemoryState &temporary_memory_state) {
 	UpdateConfiguration(context);
 
@@ -158,9 +192,13 @@ void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemory
 
 void TemporaryMemoryManager::SetRemainingSize(TemporaryMemoryState &temporary_memory_state, idx_t new_remaining_size) {
 	D_ASSERT(this->remaining_size >= temporary_memory_state.GetRemainingSize());
-	this->remaining_size -= temporary_memory_state.GetRemainingSize();
+	const auto old_remaining_size = temporary_memory_state.GetRemainingSize();
+	this->remaining_size -= old_remaining_size;
 	temporary_memory_state.remaining_size = new_remaining_size;
 	this->remaining_size += temporary_memory_state.GetRemainingSize();
+	if (new_remaining_size < old_remaining_size) {
+		admission_cv.notify_all();
+	}
 }
 
 void TemporaryMemoryManager::SetReservation(TemporaryMemoryState &temporary_memory_state, idx_t new_reservation) {
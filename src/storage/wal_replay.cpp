@@ -539,7 +539,7 @@ void WriteAheadLogDeserializer::ReplayDropTableMacro() {
 void WriteAheadLogDeserializer::ReplayCreateIndex() {
 	auto create_info = deserializer.ReadProperty<unique_ptr<CreateInfo>>(101, "index_catalog_entry");
 	auto index_info = deserializer.ReadProperty<IndexStorageInfo>(102, "index_storage_info");
-	D_ASSERT(index_info.IsValid() && !index_info.name.empty());
+	D_ASSERT(index_info.HasInfo() && !index_info.name.empty());
 
 	auto &storage_manager = db.GetStorageManager();
 	auto &single_file_sm = storage_manager.Cast<SingleFileStorageManager>();
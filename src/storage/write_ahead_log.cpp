@@ -17,12 +17,16 @@
 #include "duckdb/common/serializer/memory_stream.hpp"
 #include "duckdb/storage/table/column_data.hpp"
 
+#include <chrono>
+#include <thread>
+
 namespace duckdb {
 
 const uint64_t WAL_VERSION_NUMBER = 2;
 
 WriteAheadLog::WriteAheadLog(AttachedDatabase &database, const string &wal_path)
-    : database(database), wal_path(wal_path), wal_size(0), initialized(false) {
+    : database(database), wal_path(wal_path), wal_size(0), initialized(false), written_flushes(0), synced_flushes(0),
+      syncing(false) {
 }
 
 WriteAheadLog::~WriteAheadLog() {
@@ -423,4 +427,50 @@ void WriteAheadLog::Flush() {
 	wal_size = writer->GetFileSize();
 }
 
+idx_t WriteAheadLog::FlushWithoutSync() {
+	D_ASSERT(writer);
+
+	// write an empty entry
+	WriteAheadLogSerializer serializer(*this, WALType::WAL_FLUSH);
+	serializer.End();
+
+	// hand the changes to the file system - these are synced to disk by SyncFlush
+	writer->Flush();
+	wal_size = writer->GetFileSize();
+	return ++written_flushes;
+}
+
+void WriteAheadLog::SyncFlush(idx_t flush_id, idx_t max_wait) {
+	unique_lock<mutex> guard(sync_lock);
+	while (synced_flushes < flush_id) {
+		if (syncing) {
+			// another thread is syncing the WAL - wait for it, the sync might include our flush
+			sync_cv.wait(guard);
+			continue;
+		}
+		// sync the WAL on behalf of all flushes that have been written so far
+		syncing = true;
+		guard.unlock();
+		if (max_wait > 0) {
+			// give concurrent commits the chance to write their flushes, so they are included in this sync
+			std::this_thread::sleep_for(std::chrono::microseconds(max_wait));
+		}
+		idx_t sync_target = written_flushes;
+		ErrorData error;
+		try {
+			writer->handle->Sync();
+		} catch (std::exception &ex) {
+			error = ErrorData(ex);
+		}
+		guard.lock();
+		syncing = false;
+		sync_cv.notify_all();
+		if (error.HasError()) {
+			// the commits have already been made visible, but we cannot guarantee that they are durable
+			throw FatalException("Failed to sync the WAL: %s", error.RawMessage());
+		}
+		synced_flushes = MaxValue<idx_t>(synced_flushes, sync_target);
+	}
+}
+
 } // namespace duckdb
@@ -217,7 +217,7 @@ ErrorData DuckTransaction::WriteToWAL(AttachedDatabase &db, unique_ptr<StorageCo
 }
 
 ErrorData DuckTransaction::Commit(AttachedDatabase &db, transaction_t new_commit_id,
-                                  unique_ptr<StorageCommitState> commit_state) noexcept {
+                                  optional_ptr<StorageCommitState> commit_state) noexcept {
 	// "checkpoint" parameter indicates if the caller will checkpoint. If checkpoint ==
 	//    true: Then this function will NOT write to the WAL or flush/persist.
 	//          This method only makes commit in memory, expecting caller to checkpoint/flush.
@@ -231,7 +231,7 @@ ErrorData DuckTransaction::Commit(AttachedDatabase &db, transaction_t new_commit
 
 	UndoBuffer::IteratorState iterator_state;
 	try {
-		storage->Commit(commit_state.get());
+		storage->Commit(commit_state);
 		undo_buffer.Commit(iterator_state, commit_id);
 		if (commit_state) {
 			// if we have written to the WAL - flush after the commit has been successful
@@ -13,10 +13,44 @@
 #include "duckdb/main/connection_manager.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/valid_checker.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
 
 namespace duckdb {
 
+struct BackgroundCheckpointState {
+	explicit BackgroundCheckpointState(DuckTransactionManager &manager)
+	    : manager(manager), scheduled(false), shutdown(false) {
+	}
+
+	DuckTransactionManager &manager;
+	//! Held while a background checkpoint is running
+	mutex lock;
+	//! Whether a background checkpoint has been scheduled but has not started yet
+	atomic<bool> scheduled;
+	//! Set when the database is closed - the manager must no longer be accessed by background tasks
+	atomic<bool> shutdown;
+};
+
+class BackgroundCheckpointTask : public Task {
+public:
+	explicit BackgroundCheckpointTask(shared_ptr<BackgroundCheckpointState> state_p) : state(std::move(state_p)) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		lock_guard<mutex> guard(state->lock);
+		state->scheduled = false;
+		if (!state->shutdown) {
+			state->manager.BackgroundCheckpoint();
+		}
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	shared_ptr<BackgroundCheckpointState> state;
+};
+
 DuckTransactionManager::DuckTransactionManager(AttachedDatabase &db) : TransactionManager(db) {
 	// start timestamp starts at two
 	current_start_timestamp = 2;
@@ -27,6 +61,7 @@ DuckTransactionManager::DuckTransactionManager(AttachedDatabase &db) : Transacti
 	current_transaction_id = TRANSACTION_ID_START;
 	lowest_active_id = TRANSACTION_ID_START;
 	lowest_active_start = MAX_TRANSACTION_ID;
+	background_checkpoint = make_shared_ptr<BackgroundCheckpointState>(*this);
 	if (!db.GetCatalog().IsDuckCatalog()) {
 		// Specifically the StorageManager of the DuckCatalog is relied on, with `db.GetStorageManager`
 		throw InternalException("DuckTransactionManager should only be created together with a DuckCatalog");
@@ -104,6 +139,14 @@ DuckTransactionManager::CanCheckpoint(DuckTransaction &transaction, unique_ptr<S
 	if (config.options.debug_skip_checkpoint_on_commit) {
 		return CheckpointDecision("checkpointing on commit disabled through configuration");
 	}
+	if (config.options.background_checkpoint &&
+	    TaskScheduler::GetScheduler(db.GetDatabase()).NumberOfBackgroundThreads() > 0) {
+		// the commit writes to the WAL as usual - a background thread checkpoints once the transaction has finished
+		// without background threads, the task would never be executed: we checkpoint as part of the commit instead
+		CheckpointDecision decision("checkpoint is performed by a background thread");
+		decision.schedule_background = true;
+		return decision;
+	}
 	// try to lock the checkpoint lock
 	lock = transaction.TryGetCheckpointLock();
 	if (!lock) {
@@ -198,6 +241,57 @@ void DuckTransactionManager::Checkpoint(ClientContext &context, bool force) {
 	storage_manager.CreateCheckpoint(options);
 }
 
+void DuckTransactionManager::BackgroundCheckpoint() {
+	// if a write transaction is active we give up - the next commit that exceeds the threshold schedules a new attempt
+	auto lock = checkpoint_lock.TryGetExclusiveLock();
+	if (!lock) {
+		return;
+	}
+	CheckpointOptions options;
+	if (GetLastCommit() > LowestActiveStart()) {
+		// we cannot do a full checkpoint if any transaction needs to read old data
+		options.type = CheckpointType::CONCURRENT_CHECKPOINT;
+	}
+	try {
+		db.GetStorageManager().CreateCheckpoint(options);
+	} catch (std::exception &ex) {
+		// there is no client to report the error to - invalidate the database instead
+		ErrorData error(ex);
+		ValidChecker::Invalidate(db.GetDatabase(), error.RawMessage());
+	}
+}
+
+void DuckTransactionManager::ScheduleBackgroundCheckpoint() {
+	if (background_checkpoint->shutdown || background_checkpoint->scheduled) {
+		return;
+	}
+	auto &scheduler = TaskScheduler::GetScheduler(db.GetDatabase());
+	if (!background_checkpoint_token) {
+		background_checkpoint_token = scheduler.CreateProducer();
+	}
+	background_checkpoint->scheduled = true;
+	scheduler.ScheduleTask(*background_checkpoint_token,
+	                       make_shared_ptr<BackgroundCheckpointTask>(background_checkpoint));
+}
+
+void DuckTransactionManager::StopBackgroundCheckpoints() {
+	{
+		// wait for a running background checkpoint to finish
+		lock_guard<mutex> guard(background_checkpoint->lock);
+		background_checkpoint->shutdown = true;
+	}
+	lock_guard<mutex> lock(transaction_lock);
+	if (!background_checkpoint_token) {
+		return;
+	}
+	// the token must be destroyed before the task scheduler: discard the tasks that have not started yet
+	auto &scheduler = TaskScheduler::GetScheduler(db.GetDatabase());
+	shared_ptr<Task> task;
+	while (scheduler.GetTaskFromProducer(*background_checkpoint_token, task)) {
+	}
+	background_checkpoint_token.reset();
+}
+
 unique_ptr<StorageLockKey> DuckTransactionManager::SharedCheckpointLock() {
 	return checkpoint_lock.GetSharedLock();
 }
@@ -256,7 +350,7 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 	transaction_t commit_id = GetCommitTimestamp();
 	// commit the UndoBuffer of the transaction
 	if (!error.HasError()) {
-		error = transaction.Commit(db, commit_id, std::move(commit_state));
+		error = transaction.Commit(db, commit_id, commit_state.get());
 	}
 	if (error.HasError()) {
 		// commit unsuccessful: rollback the transaction instead
@@ -268,6 +362,19 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 		if (transaction.catalog_version >= TRANSACTION_ID_START) {
 			transaction.catalog_version = ++last_committed_version;
 		}
+		if (commit_state && commit_state->RequiresSync()) {
+			// group commit: the WAL is synced outside of the transaction and WAL locks, so that concurrent commits can
+			// write to the WAL in the meantime and are synced together with this commit
+			// the transaction keeps its write lock, which prevents a checkpoint from replacing the WAL
+			held_wal_lock.reset();
+			tlock.unlock();
+			try {
+				commit_state->SyncCommit();
+			} catch (std::exception &ex) {
+				error = ErrorData(ex);
+			}
+			tlock.lock();
+		}
 	}
 	OnCommitCheckpointDecision(checkpoint_decision, transaction);
 
@@ -280,6 +387,9 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 	// potentially resulting in garbage collection
 	bool store_transaction = undo_properties.has_updates || undo_properties.has_catalog_changes || error.HasError();
 	RemoveTransaction(transaction, store_transaction);
+	if (checkpoint_decision.schedule_background) {
+		ScheduleBackgroundCheckpoint();
+	}
 	// now perform a checkpoint if (1) we are able to checkpoint, and (2) the WAL has reached sufficient size to
 	// checkpoint
 	if (checkpoint_decision.can_checkpoint) {
@@ -48,6 +48,7 @@ OptionValueSet GetValueForOption(const string &name, LogicalTypeId type) {
 	    {"threads", {Value::BIGINT(42), Value::BIGINT(42)}},
 	    {"checkpoint_threshold", {"4.0 GiB"}},
 	    {"debug_checkpoint_abort", {{"none", "before_truncate", "before_header", "after_free_list_write"}}},
+	    {"compression_analyze_sample", {Value::DOUBLE(0.5)}},
 	    {"default_collation", {"nocase"}},
 	    {"default_order", {"desc"}},
 	    {"default_null_order", {"nulls_first"}},
@@ -87,10 +88,12 @@ OptionValueSet GetValueForOption(const string &name, LogicalTypeId type) {
 	    {"ordered_aggregate_threshold", {Value::UBIGINT(idx_t(1) << 12)}},
 	    {"null_order", {"nulls_first"}},
 	    {"perfect_ht_threshold", {0}},
+	    {"pin_threads", {"auto"}},
 	    {"pivot_filter_threshold", {999}},
 	    {"pivot_limit", {999}},
 	    {"partitioned_write_flush_threshold", {123}},
 	    {"preserve_identifier_case", {false}},
+	    {"sort_aggregate_memory_ratio", {Value::DOUBLE(2.5)}},
 	    {"preserve_insertion_order", {false}},
 	    {"profile_output", {"test"}},
 	    {"profiling_mode", {"detailed"}},
@@ -99,6 +102,7 @@ OptionValueSet GetValueForOption(const string &name, LogicalTypeId type) {
 	    {"ieee_floating_point_ops", {false}},
 	    {"progress_bar_time", {0}},
 	    {"temp_directory", {"tmp"}},
+	    {"result_cache_memory_limit", {"4.0 GiB"}},
 	    {"wal_autocheckpoint", {"4.0 GiB"}},
 	    {"force_bitpacking_mode", {"constant"}},
 	    {"http_proxy", {"localhost:80"}},